@@ -0,0 +1,155 @@
+/**
+ * @file
+ *
+ * Benchmark suite runner of LibISAAC.
+ *
+ * Prints a table of the results, or with `--json [file]` writes them as JSON
+ * to the file or to the standard output, for comparing builds with a script.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "bench.h"
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_TSC 1
+#else
+#define BENCH_TSC 0
+#endif
+
+/* Duration of the calibration of the time-stamp counter in seconds. */
+#define BENCH_CALIBRATION_SECONDS 0.1
+
+static volatile uint8_t bench_sink;
+/* Destination of the JSON results, NULL to print the table. */
+static FILE* bench_json;
+/* True until the first result is written into the JSON array. */
+static bool bench_json_first = true;
+/* Ticks of the time-stamp counter per second, 0 without it. */
+static double bench_cycles_per_second;
+
+double bench_seconds(void)
+{
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (double) now.tv_sec + (double) now.tv_nsec * 1e-9;
+}
+
+/**
+ * Measures the frequency of the time-stamp counter against the clock, so the
+ * times can be converted into cycles.
+ *
+ * The counter ticks at the nominal frequency of the CPU, which is the one
+ * the cycles per byte are usually quoted at.
+ */
+static double calibrate_cycles_per_second(void)
+{
+#if BENCH_TSC
+    const double start = bench_seconds();
+    const uint64_t start_ticks = __rdtsc();
+    double elapsed;
+    do
+    {
+        elapsed = bench_seconds() - start;
+    }
+    while (elapsed < BENCH_CALIBRATION_SECONDS);
+    return (double) (__rdtsc() - start_ticks) / elapsed;
+#else
+    return 0;
+#endif
+}
+
+void bench_report(const char* const name,
+                  const size_t bytes,
+                  const size_t calls,
+                  const double seconds)
+{
+    const double ns_per_call = seconds * 1e9 / (double) calls;
+    const double cycles_per_byte =
+            seconds * bench_cycles_per_second / (double) bytes;
+    if (bench_json != NULL)
+    {
+        fprintf(bench_json, "%s\n    {\"name\": \"%s\", \"bytes\": %zu, "
+                            "\"calls\": %zu, \"seconds\": %.6f, "
+                            "\"mb_per_s\": %.3f, \"ns_per_call\": %.3f, ",
+                bench_json_first ? "" : ",", name, bytes, calls, seconds,
+                (double) bytes / seconds * 1e-6, ns_per_call);
+        if (bench_cycles_per_second > 0)
+        {
+            fprintf(bench_json, "\"cycles_per_byte\": %.4f}",
+                    cycles_per_byte);
+        }
+        else
+        {
+            fprintf(bench_json, "\"cycles_per_byte\": null}");
+        }
+        bench_json_first = false;
+    }
+    else if (bench_cycles_per_second > 0)
+    {
+        printf("%-40s %10.1f MB/s %12.1f ns/call %8.3f cycles/B\n", name,
+               (double) bytes / seconds * 1e-6, ns_per_call, cycles_per_byte);
+    }
+    else
+    {
+        printf("%-40s %10.1f MB/s %12.1f ns/call\n", name,
+               (double) bytes / seconds * 1e-6, ns_per_call);
+    }
+}
+
+void bench_consume(const uint8_t byte)
+{
+    bench_sink = byte;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1 && strcmp(argv[1], "--json") == 0)
+    {
+        bench_json = argc > 2 ? fopen(argv[2], "w") : stdout;
+        if (bench_json == NULL)
+        {
+            fprintf(stderr, "Cannot open %s\n", argv[2]);
+            return 1;
+        }
+    }
+    else if (argc > 1)
+    {
+        fprintf(stderr, "Usage: %s [--json [file]]\n", argv[0]);
+        return 1;
+    }
+    bench_cycles_per_second = calibrate_cycles_per_second();
+    if (bench_json != NULL)
+    {
+        fprintf(bench_json, "{\n  \"bits\": %d,\n  \"kernel\": \"%s\",\n"
+                            "  \"cycles_per_second\": %.0f,\n"
+                            "  \"results\": [",
+                ISAAC_BITS, isaac_kernel_name(), bench_cycles_per_second);
+    }
+    else
+    {
+        printf("LibISAAC benchmark, ISAAC_BITS=%d, kernel %s\n", ISAAC_BITS,
+               isaac_kernel_name());
+    }
+    bench_isaac_init();
+    bench_isaac_convert();
+    bench_isaac_stream();
+    bench_isaac_stream_sizes();
+    bench_isaac_uniform();
+    bench_isaac_permute();
+    bench_isaac_parallel();
+    if (bench_json != NULL)
+    {
+        fprintf(bench_json, "\n  ]\n}\n");
+        if (bench_json != stdout)
+        {
+            fclose(bench_json);
+        }
+    }
+    return 0;
+}
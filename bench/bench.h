@@ -0,0 +1,65 @@
+/**
+ * @file
+ *
+ * Benchmark suite of LibISAAC, measuring throughput.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "isaac.h"
+#include <stdio.h>
+
+/** Minimum duration of each measurement in seconds. */
+#define BENCH_MIN_SECONDS 0.25
+
+/**
+ * Current time in seconds, with the best resolution available.
+ */
+double bench_seconds(void);
+
+/**
+ * Prints one measurement, as a row of the results table or as an object of
+ * the JSON results.
+ *
+ * Besides the throughput, reports the time per call and, where the CPU has a
+ * time-stamp counter, the cycles per byte.
+ *
+ * @param[in] name what was measured
+ * @param[in] bytes amount of bytes processed
+ * @param[in] calls amount of calls processing them
+ * @param[in] seconds time it took
+ */
+void bench_report(const char* name, size_t bytes, size_t calls,
+                  double seconds);
+
+/**
+ * Consumes a byte so that the compiler cannot optimise away its computation.
+ */
+void bench_consume(uint8_t byte);
+
+void bench_isaac_init(void);
+void bench_isaac_convert(void);
+void bench_isaac_stream(void);
+void bench_isaac_stream_sizes(void);
+void bench_isaac_uniform(void);
+void bench_isaac_permute(void);
+void bench_isaac_parallel(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* BENCH_H */
@@ -0,0 +1,128 @@
+/**
+ * @file
+ *
+ * Benchmark suite of LibISAAC, measuring the functions converting
+ * isaac_uint_t to bytes against the original byte-by-byte loops.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "bench.h"
+#include <string.h>
+
+/* Fits in the L2 cache, so the conversion is measured, not the memory. */
+#define CONVERT_VALUES 8192U
+
+typedef void (*convert_fn)(uint8_t* bytes,
+                           const isaac_uint_t* values,
+                           size_t amount_of_values);
+
+static isaac_uint_t values[CONVERT_VALUES];
+static uint8_t bytes[sizeof(values)];
+static uint8_t reference[sizeof(values)];
+
+/**
+ * Original implementation of isaac_to_little_endian(), for comparison.
+ */
+static void bytewise_to_little_endian(uint8_t* out,
+                                      const isaac_uint_t* in,
+                                      size_t amount_of_values)
+{
+    while (amount_of_values--)
+    {
+        *out++ = (uint8_t) (*in);
+        *out++ = (uint8_t) (*in >> 8U);
+        *out++ = (uint8_t) (*in >> 16U);
+        *out++ = (uint8_t) (*in >> 24U);
+#if ISAAC_BITS > 32
+        *out++ = (uint8_t) (*in >> 32U);
+        *out++ = (uint8_t) (*in >> 40U);
+        *out++ = (uint8_t) (*in >> 48U);
+        *out++ = (uint8_t) (*in >> 56U);
+#endif
+        in++;
+    }
+}
+
+/**
+ * Original implementation of isaac_to_big_endian(), for comparison.
+ */
+static void bytewise_to_big_endian(uint8_t* out,
+                                   const isaac_uint_t* in,
+                                   size_t amount_of_values)
+{
+    while (amount_of_values--)
+    {
+#if ISAAC_BITS > 32
+        *out++ = (uint8_t) (*in >> 56U);
+        *out++ = (uint8_t) (*in >> 48U);
+        *out++ = (uint8_t) (*in >> 40U);
+        *out++ = (uint8_t) (*in >> 32U);
+#endif
+        *out++ = (uint8_t) (*in >> 24U);
+        *out++ = (uint8_t) (*in >> 16U);
+        *out++ = (uint8_t) (*in >> 8U);
+        *out++ = (uint8_t) (*in++);
+    }
+}
+
+/**
+ * Measures a converter, checking that it produces the same bytes as the
+ * original one.
+ */
+static void measure(const char* const name,
+                    const convert_fn convert,
+                    const convert_fn original)
+{
+    size_t repetitions = 0;
+    double elapsed;
+    original(reference, values, CONVERT_VALUES);
+    convert(bytes, values, CONVERT_VALUES);
+    if (memcmp(bytes, reference, sizeof(bytes)) != 0)
+    {
+        fprintf(stderr, "%-40s MISMATCH\n", name);
+        return;
+    }
+    const double start = bench_seconds();
+    do
+    {
+        convert(bytes, values, CONVERT_VALUES);
+        bench_consume(bytes[repetitions % sizeof(bytes)]);
+        repetitions++;
+        elapsed = bench_seconds() - start;
+    }
+    while (elapsed < BENCH_MIN_SECONDS);
+    bench_report(name, repetitions * sizeof(bytes), repetitions, elapsed);
+}
+
+void bench_isaac_convert(void)
+{
+    static const char* const kernels[] = {
+            "portable", "sse4", "avx2", "avx512", "neon"
+    };
+    char name[64];
+    isaac_ctx_t ctx;
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, values, CONVERT_VALUES);
+    isaac_cleanup(&ctx);
+
+    measure("bytewise_to_little_endian", bytewise_to_little_endian,
+            bytewise_to_little_endian);
+    measure("bytewise_to_big_endian", bytewise_to_big_endian,
+            bytewise_to_big_endian);
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++)
+    {
+        if (!isaac_kernel_select(kernels[k]))
+        {
+            continue;  // Not supported by this CPU
+        }
+        snprintf(name, sizeof(name), "isaac_to_little_endian [%s]",
+                 kernels[k]);
+        measure(name, isaac_to_little_endian, bytewise_to_little_endian);
+        snprintf(name, sizeof(name), "isaac_to_big_endian [%s]", kernels[k]);
+        measure(name, isaac_to_big_endian, bytewise_to_big_endian);
+    }
+    isaac_kernel_select(NULL);
+}
@@ -0,0 +1,103 @@
+/**
+ * @file
+ *
+ * Benchmark suite of LibISAAC, measuring the latency of the initialisation
+ * and the cost of the reshuffle generating each batch.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "bench.h"
+
+/* Calls between two readings of the clock, so its cost is negligible. */
+#define INIT_CALLS 64U
+/* Batches skipped at the time, so only the reshuffle is measured. */
+#define RESHUFFLE_BATCHES 64U
+
+static const uint8_t seed[32] = {
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+        17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+};
+
+static void measure_init(void)
+{
+    isaac_ctx_t ctx;
+    size_t calls = 0;
+    double elapsed;
+    const double start = bench_seconds();
+    do
+    {
+        for (size_t i = 0; i < INIT_CALLS; i++)
+        {
+            isaac_init(&ctx, seed, sizeof(seed));
+        }
+        bench_consume((uint8_t) ctx.result[calls % ISAAC_ELEMENTS]);
+        calls += INIT_CALLS;
+        elapsed = bench_seconds() - start;
+    }
+    while (elapsed < BENCH_MIN_SECONDS);
+    /* The bytes are the ones of the first batch, ready to be output. */
+    bench_report("isaac_init", calls * sizeof(ctx.result), calls, elapsed);
+    isaac_cleanup(&ctx);
+}
+
+static void measure_init_many(void)
+{
+    static isaac_ctx_t ctxs[INIT_CALLS];
+    const uint8_t* seeds[INIT_CALLS];
+    uint16_t seed_bytes[INIT_CALLS];
+    size_t contexts = 0;
+    double elapsed;
+    for (size_t i = 0; i < INIT_CALLS; i++)
+    {
+        seeds[i] = seed;
+        seed_bytes[i] = sizeof(seed);
+    }
+    const double start = bench_seconds();
+    do
+    {
+        isaac_init_many(ctxs, seeds, seed_bytes, INIT_CALLS);
+        bench_consume((uint8_t) ctxs[0].result[contexts % ISAAC_ELEMENTS]);
+        contexts += INIT_CALLS;
+        elapsed = bench_seconds() - start;
+    }
+    while (elapsed < BENCH_MIN_SECONDS);
+    /* Reported per context, to compare with isaac_init(). */
+    bench_report("isaac_init_many per context",
+                 contexts * sizeof(ctxs[0].result), contexts, elapsed);
+    for (size_t i = 0; i < INIT_CALLS; i++)
+    {
+        isaac_cleanup(&ctxs[i]);
+    }
+}
+
+static void measure_reshuffle(void)
+{
+    isaac_ctx_t ctx;
+    size_t batches = 0;
+    double elapsed;
+    isaac_init(&ctx, seed, sizeof(seed));
+    const double start = bench_seconds();
+    do
+    {
+        /* Whole batches are reshuffled without being stored anywhere. */
+        isaac_discard(&ctx, RESHUFFLE_BATCHES * ISAAC_ELEMENTS);
+        bench_consume((uint8_t) ctx.result[batches % ISAAC_ELEMENTS]);
+        batches += RESHUFFLE_BATCHES;
+        elapsed = bench_seconds() - start;
+    }
+    while (elapsed < BENCH_MIN_SECONDS);
+    /* Reported per batch of ISAAC_ELEMENTS integers. */
+    bench_report("reshuffle per batch", batches * sizeof(ctx.result),
+                 batches, elapsed);
+    isaac_cleanup(&ctx);
+}
+
+void bench_isaac_init(void)
+{
+    measure_init();
+    measure_init_many();
+    measure_reshuffle();
+}
@@ -0,0 +1,65 @@
+/**
+ * @file
+ *
+ * Benchmark suite of LibISAAC, measuring the parallel generation of a large
+ * buffer against a single stream.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "bench.h"
+#include <stdlib.h>
+
+/* 256 MiB, much larger than the caches. */
+#define PARALLEL_BYTES (256U * 1024U * 1024U)
+#define PARALLEL_WORDS (PARALLEL_BYTES / sizeof(isaac_uint_t))
+
+static isaac_uint_t* values;
+
+static void measure(const char* const name, const size_t threads)
+{
+    isaac_ctx_t ctx;
+    size_t repetitions = 0;
+    double elapsed;
+    isaac_init(&ctx, NULL, 0);
+    const double start = bench_seconds();
+    do
+    {
+        if (threads == 0)
+        {
+            isaac_stream(&ctx, values, PARALLEL_WORDS);
+        }
+        else
+        {
+            isaac_fill_parallel(NULL, 0, values, PARALLEL_WORDS, threads);
+        }
+        bench_consume((uint8_t) values[repetitions % PARALLEL_WORDS]);
+        repetitions++;
+        elapsed = bench_seconds() - start;
+    }
+    while (elapsed < BENCH_MIN_SECONDS);
+    bench_report(name, repetitions * PARALLEL_BYTES, repetitions, elapsed);
+    isaac_cleanup(&ctx);
+}
+
+void bench_isaac_parallel(void)
+{
+    char name[64];
+    values = malloc(PARALLEL_BYTES);
+    if (values == NULL)
+    {
+        return;
+    }
+    // Untimed pass, keeping the page faults out of the measurements
+    isaac_fill_parallel(NULL, 0, values, PARALLEL_WORDS, 1);
+    measure("isaac_stream 256 MiB", 0);
+    for (size_t threads = 1; threads <= 16; threads *= 2)
+    {
+        snprintf(name, sizeof(name), "isaac_fill_parallel 256 MiB x%zu",
+                 threads);
+        measure(name, threads);
+    }
+    free(values);
+}
@@ -0,0 +1,95 @@
+/**
+ * @file
+ *
+ * Benchmark suite of LibISAAC, measuring the shuffles against the usual
+ * Fisher-Yates loop over the stream, in and out of the cache.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "bench.h"
+#include <stdlib.h>
+
+/* Fits in the cache. */
+#define PERMUTE_SMALL 16384U
+/* 128 MiB, larger than the last level cache. */
+#define PERMUTE_LARGE (32U * 1024U * 1024U)
+
+static uint32_t* values;
+static size_t values_count;
+
+/**
+ * The biased shuffle, one integer of the stream and a division per swap,
+ * this library's shuffle replaces.
+ */
+static void modulo(isaac_ctx_t* const ctx)
+{
+    for (size_t i = values_count - 1; i > 0; i--)
+    {
+        isaac_uint_t word;
+        isaac_stream(ctx, &word, 1);
+        const size_t j = (size_t) (word % (i + 1));
+        const uint32_t tmp = values[i];
+        values[i] = values[j];
+        values[j] = tmp;
+    }
+}
+
+static void shuffle_array(isaac_ctx_t* const ctx)
+{
+    isaac_shuffle_array(ctx, values, values_count, sizeof(uint32_t));
+}
+
+static void permutation_u32(isaac_ctx_t* const ctx)
+{
+    isaac_permutation_u32(ctx, values, (uint32_t) values_count);
+}
+
+static void measure(const char* const name,
+                    void (* const generate)(isaac_ctx_t*))
+{
+    isaac_ctx_t ctx;
+    size_t repetitions = 0;
+    double elapsed;
+    isaac_init(&ctx, NULL, 0);
+    const double start = bench_seconds();
+    do
+    {
+        generate(&ctx);
+        bench_consume((uint8_t) values[repetitions % values_count]);
+        repetitions++;
+        elapsed = bench_seconds() - start;
+    }
+    while (elapsed < BENCH_MIN_SECONDS);
+    bench_report(name, repetitions * values_count * sizeof(uint32_t),
+                 repetitions, elapsed);
+    isaac_cleanup(&ctx);
+}
+
+void bench_isaac_permute(void)
+{
+    static const size_t counts[] = {PERMUTE_SMALL, PERMUTE_LARGE};
+    char name[64];
+    values = malloc(PERMUTE_LARGE * sizeof(uint32_t));
+    if (values == NULL)
+    {
+        return;
+    }
+    for (size_t i = 0; i < PERMUTE_LARGE; i++)
+    {
+        values[i] = (uint32_t) i;
+    }
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++)
+    {
+        values_count = counts[c];
+        snprintf(name, sizeof(name), "isaac_stream %% (i+1) %zu", counts[c]);
+        measure(name, modulo);
+        snprintf(name, sizeof(name), "isaac_shuffle_array %zu", counts[c]);
+        measure(name, shuffle_array);
+        snprintf(name, sizeof(name), "isaac_permutation_u32 %zu", counts[c]);
+        measure(name, permutation_u32);
+    }
+    free(values);
+}
@@ -0,0 +1,156 @@
+/**
+ * @file
+ *
+ * Benchmark suite of LibISAAC, measuring the generation of bytes.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "bench.h"
+#include <stdlib.h>
+
+/* Fits in the L2 cache, so the generation is measured, not the memory. */
+#define STREAM_VALUES (64U * ISAAC_ELEMENTS)
+
+/* Largest request measured by bench_isaac_stream_sizes(), 1 GiB. */
+#define STREAM_MAX_BYTES (1024U * 1024U * 1024U)
+/* Integers generated between two readings of the clock, at least. */
+#define STREAM_CHECK_VALUES 65536U
+
+static isaac_uint_t values[STREAM_VALUES];
+static uint8_t bytes[sizeof(values)];
+
+/**
+ * Generates bytes in two passes: integers first, then their conversion.
+ */
+static void two_passes(isaac_ctx_t* const ctx,
+                       const isaac_byte_order_t order)
+{
+    isaac_stream(ctx, values, STREAM_VALUES);
+    if (order == ISAAC_BIG_ENDIAN)
+    {
+        isaac_to_big_endian(bytes, values, STREAM_VALUES);
+    }
+    else
+    {
+        isaac_to_little_endian(bytes, values, STREAM_VALUES);
+    }
+}
+
+/**
+ * Generates bytes in a single pass, serialising while generating.
+ */
+static void fused(isaac_ctx_t* const ctx, const isaac_byte_order_t order)
+{
+    if (order == ISAAC_BIG_ENDIAN)
+    {
+        isaac_stream_big_endian(ctx, bytes, sizeof(bytes));
+    }
+    else
+    {
+        isaac_stream_little_endian(ctx, bytes, sizeof(bytes));
+    }
+}
+
+static void measure(const char* const name,
+                    void (* const generate)(isaac_ctx_t*, isaac_byte_order_t),
+                    const isaac_byte_order_t order)
+{
+    isaac_ctx_t ctx;
+    size_t repetitions = 0;
+    double elapsed;
+    isaac_init(&ctx, NULL, 0);
+    const double start = bench_seconds();
+    do
+    {
+        generate(&ctx, order);
+        bench_consume(bytes[repetitions % sizeof(bytes)]);
+        repetitions++;
+        elapsed = bench_seconds() - start;
+    }
+    while (elapsed < BENCH_MIN_SECONDS);
+    bench_report(name, repetitions * sizeof(bytes), repetitions, elapsed);
+    isaac_cleanup(&ctx);
+}
+
+void bench_isaac_stream(void)
+{
+    measure("isaac_stream + isaac_to_little_endian", two_passes,
+            ISAAC_LITTLE_ENDIAN);
+    measure("isaac_stream_little_endian", fused, ISAAC_LITTLE_ENDIAN);
+    measure("isaac_stream + isaac_to_big_endian", two_passes,
+            ISAAC_BIG_ENDIAN);
+    measure("isaac_stream_big_endian", fused, ISAAC_BIG_ENDIAN);
+}
+
+/**
+ * Measures isaac_stream() with requests of a fixed size, reading the clock
+ * only every #STREAM_CHECK_VALUES integers so small requests are not
+ * dominated by it.
+ */
+static void measure_size(isaac_uint_t* const buffer, const size_t words)
+{
+    char name[64];
+    isaac_ctx_t ctx;
+    const size_t length = words * sizeof(isaac_uint_t);
+    const size_t calls_per_check = words < STREAM_CHECK_VALUES
+                                   ? STREAM_CHECK_VALUES / words : 1U;
+    size_t calls = 0;
+    double elapsed;
+    if (length >= 1024U * 1024U)
+    {
+        snprintf(name, sizeof(name), "isaac_stream %zu MiB", length >> 20U);
+    }
+    else if (length >= 1024U)
+    {
+        snprintf(name, sizeof(name), "isaac_stream %zu KiB", length >> 10U);
+    }
+    else
+    {
+        snprintf(name, sizeof(name), "isaac_stream %zu B", length);
+    }
+    isaac_init(&ctx, NULL, 0);
+    const double start = bench_seconds();
+    do
+    {
+        for (size_t i = 0; i < calls_per_check; i++)
+        {
+            isaac_stream(&ctx, buffer, words);
+        }
+        bench_consume((uint8_t) buffer[calls % words]);
+        calls += calls_per_check;
+        elapsed = bench_seconds() - start;
+    }
+    while (elapsed < BENCH_MIN_SECONDS);
+    bench_report(name, calls * length, calls, elapsed);
+    isaac_cleanup(&ctx);
+}
+
+void bench_isaac_stream_sizes(void)
+{
+    size_t max_words = STREAM_MAX_BYTES / sizeof(isaac_uint_t);
+    isaac_uint_t* buffer = malloc(max_words * sizeof(isaac_uint_t));
+    while (buffer == NULL && max_words > STREAM_VALUES)
+    {
+        max_words /= 2U;
+        buffer = malloc(max_words * sizeof(isaac_uint_t));
+    }
+    if (buffer == NULL)
+    {
+        return;
+    }
+    // Untimed pass, keeping the page faults out of the measurements
+    isaac_ctx_t ctx;
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, buffer, max_words);
+    isaac_cleanup(&ctx);
+    // From a single integer to the whole buffer, 4 times larger each time
+    for (size_t words = 1; words < max_words; words *= 4U)
+    {
+        measure_size(buffer, words);
+    }
+    measure_size(buffer, max_words);
+    free(buffer);
+}
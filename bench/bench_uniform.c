@@ -0,0 +1,125 @@
+/**
+ * @file
+ *
+ * Benchmark suite of LibISAAC, measuring the uniform distributions against
+ * the usual conversions of the stream.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "bench.h"
+#include <math.h>
+
+#define UNIFORM_COUNT 16384U
+#define UNIFORM_BOUND 1000U
+
+static isaac_uint_t words[UNIFORM_COUNT];
+static uint32_t values[UNIFORM_COUNT];
+static double doubles[UNIFORM_COUNT];
+
+/**
+ * The biased reduction this library's bounded integers replace.
+ */
+static void modulo(isaac_ctx_t* const ctx)
+{
+    isaac_stream(ctx, words, UNIFORM_COUNT);
+    for (size_t i = 0; i < UNIFORM_COUNT; i++)
+    {
+        values[i] = (uint32_t) (words[i] % UNIFORM_BOUND);
+    }
+}
+
+static void uniform(isaac_ctx_t* const ctx)
+{
+    isaac_uniform_u32(ctx, values, UNIFORM_COUNT, UNIFORM_BOUND);
+}
+
+/**
+ * The per-element division this library's doubles replace.
+ */
+static void division(isaac_ctx_t* const ctx)
+{
+    isaac_stream(ctx, words, UNIFORM_COUNT);
+    for (size_t i = 0; i < UNIFORM_COUNT; i++)
+    {
+        doubles[i] = (double) words[i] / ((double) (isaac_uint_t) -1 + 1.0);
+    }
+    values[0] = (uint32_t) (doubles[0] * 1000.0);
+}
+
+static void uniform_f64(isaac_ctx_t* const ctx)
+{
+    isaac_uniform_f64(ctx, doubles, UNIFORM_COUNT);
+    values[0] = (uint32_t) (doubles[0] * 1000.0);
+}
+
+/**
+ * The Box-Muller transform this library's normal distribution replaces.
+ */
+static void box_muller(isaac_ctx_t* const ctx)
+{
+    isaac_uniform_f64(ctx, doubles, UNIFORM_COUNT);
+    for (size_t i = 0; i < UNIFORM_COUNT; i += 2)
+    {
+        const double radius = sqrt(-2.0 * log(1.0 - doubles[i]));
+        const double angle = 6.283185307179586 * doubles[i + 1];
+        doubles[i] = radius * cos(angle);
+        doubles[i + 1] = radius * sin(angle);
+    }
+    values[0] = (uint32_t) (doubles[0] * 1000.0);
+}
+
+static void normal_f64(isaac_ctx_t* const ctx)
+{
+    isaac_normal_f64(ctx, doubles, UNIFORM_COUNT);
+    values[0] = (uint32_t) (doubles[0] * 1000.0);
+}
+
+static void measure(const char* const name,
+                    void (* const generate)(isaac_ctx_t*),
+                    const size_t bytes)
+{
+    isaac_ctx_t ctx;
+    size_t repetitions = 0;
+    double elapsed;
+    isaac_init(&ctx, NULL, 0);
+    const double start = bench_seconds();
+    do
+    {
+        generate(&ctx);
+        bench_consume((uint8_t) values[repetitions % UNIFORM_COUNT]);
+        repetitions++;
+        elapsed = bench_seconds() - start;
+    }
+    while (elapsed < BENCH_MIN_SECONDS);
+    bench_report(name, repetitions * bytes, repetitions, elapsed);
+    isaac_cleanup(&ctx);
+}
+
+void bench_isaac_uniform(void)
+{
+    static const char* const kernels[] = {
+            "portable", "sse4", "avx2", "avx512", "neon"
+    };
+    char name[64];
+    measure("isaac_stream % 1000", modulo, sizeof(values));
+    measure("isaac_stream / max", division, sizeof(doubles));
+    measure("Box-Muller", box_muller, sizeof(doubles));
+    for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); k++)
+    {
+        if (!isaac_kernel_select(kernels[k]))
+        {
+            continue;  // Not supported by this CPU
+        }
+        snprintf(name, sizeof(name), "isaac_uniform_u32 1000 [%s]",
+                 kernels[k]);
+        measure(name, uniform, sizeof(values));
+        snprintf(name, sizeof(name), "isaac_uniform_f64 [%s]", kernels[k]);
+        measure(name, uniform_f64, sizeof(doubles));
+        snprintf(name, sizeof(name), "isaac_normal_f64 [%s]", kernels[k]);
+        measure(name, normal_f64, sizeof(doubles));
+    }
+    isaac_kernel_select(NULL);
+}
@@ -61,30 +61,51 @@ extern "C"
 
 #include <stdint.h>
 #include <stddef.h>
+#include <stdbool.h>
+#include <stdalign.h>
 
 /**
  * @property #ISAAC_BITS
- * Set it to 32 or 64 to optimise ISAAC for 32 or 64 bit words respectively.
+ * Set it to 32 or 64 to choose the default ISAAC variant: the one used by the
+ * names without bitness, such as isaac_init() and #isaac_ctx_t.
  *
  * The 32 bit is the classic ISAAC; the 64 bit is ISAAC-64. Note that the output
  * differs between the two and the context grows twice in size when using the 64
  * bit version, but you also get twice the bytes per reshuffling.
- */
-/**
- * @property isaac_uint_t
- * An integer or word used by ISAAC, either a uint32_t or uint64_t.
+ *
+ * Both variants are always available with explicit names, e.g.
+ * `isaac32_init()` with `isaac32_ctx_t` and `isaac64_init()` with
+ * `isaac64_ctx_t`, so both can be used in the same program.
  */
 #ifndef ISAAC_BITS
     #define ISAAC_BITS 64
 #endif
-#if (ISAAC_BITS == 32)
-typedef uint32_t isaac_uint_t;
-#elif (ISAAC_BITS == 64)
-typedef uint64_t isaac_uint_t;
-#else
+#if (ISAAC_BITS != 32) && (ISAAC_BITS != 64)
 _Static_assert(0, "ISAAC: only 32 or 64 bit words are supported.");
 #endif
 
+/**
+ * @property #ISAAC_CTX_ALIGNED
+ * Set it to 1 to lay out #isaac_ctx_t for the cache: aligned to
+ * #ISAAC_CACHE_LINE bytes, with the fields used by every call, such as the
+ * position in the stream, first and in a cache line of their own, followed
+ * by `result[]` and `mem[]`, each starting at a cache line, ready for aligned
+ * vector loads.
+ *
+ * It changes the size and layout of the context, so the library and the
+ * programs using it must be compiled with the same value: the CMake option
+ * of the same name defines it for both.
+ */
+#ifndef ISAAC_CTX_ALIGNED
+    #define ISAAC_CTX_ALIGNED 0
+#endif
+
+/**
+ * Size in bytes of a cache line, the alignment of the contexts allocated by
+ * isaac_ctx_new().
+ */
+#define ISAAC_CACHE_LINE 64U
+
 /**
  * Amount of elements in ISAAC's context arrays.
  */
@@ -96,152 +117,228 @@ _Static_assert(0, "ISAAC: only 32 or 64 bit words are supported.");
 #define ISAAC_SEED_MAX_BYTES ISAAC_ELEMENTS
 
 /**
- * Context of the ISAAC CPRNG.
- *
- * No need to inspect it manually, use the functions instead.
+ * Byte order used to convert the pseudo-random integers to bytes.
+ */
+typedef enum
+{
+    /** Least significant byte first. */
+    ISAAC_LITTLE_ENDIAN = 0,
+    /** Most significant byte first. */
+    ISAAC_BIG_ENDIAN = 1,
+} isaac_byte_order_t;
+
+/**
+ * Amount of independent ISAAC states advanced together in a #isaac_x4_ctx_t.
+ */
+#define ISAAC_X4_LANES 4U
+
+/**
+ * Amount of independent ISAAC states advanced together in a #isaac_x8_ctx_t.
+ */
+#define ISAAC_X8_LANES 8U
+
+/**
+ * Returned by isaac_reservoir_offer() for the items not entering the
+ * reservoir.
+ */
+#define ISAAC_RESERVOIR_SKIP SIZE_MAX
+
+/**
+ * Amount of integers of each chunk of isaac_fill_parallel(), generated by its
+ * own ISAAC state.
  *
- * Maps to `randctx` from the original implementation.
+ * Part of the definition of the output: changing it changes the output.
  */
-typedef struct
+#define ISAAC_FILL_CHUNK_WORDS 65536U
+
+/**
+ * Max amount of threads used by isaac_fill_parallel().
+ */
+#define ISAAC_FILL_MAX_THREADS 256U
+
+/**
+ * Version of the format of the snapshots written by isaac_save().
+ */
+#define ISAAC_SNAPSHOT_VERSION 1U
+
+/**
+ * Max size in bytes of a snapshot written by isaac_save(), of any kind and
+ * of either ISAAC variant.
+ */
+#define ISAAC_SNAPSHOT_MAX_BYTES 4136U
+
+/**
+ * Kind of snapshot written by isaac_save().
+ */
+typedef enum
 {
+    /** The whole state, including all the values of the current batch. */
+    ISAAC_SNAPSHOT_FULL = 0,
     /**
-     * In this field the pseudo-random data is generated.
+     * The state without the values of the current batch already output,
+     * which are never output again: smaller the more of the batch was used.
      */
-    isaac_uint_t result[ISAAC_ELEMENTS];
-    /** Internal field. */
-    isaac_uint_t mem[ISAAC_ELEMENTS];
-    /** Internal field. */
-    isaac_uint_t a;
-    /** Internal field. */
-    isaac_uint_t b;
-    /** Internal field. */
-    isaac_uint_t c;
-    /**
-     * Index of the next value to output in the stream.
-     *
-     * Note: this value could be a uint16_t instead of a isaac_uint_t, but by
-     * using an isaac_uint_t we avoid any padding at the end of the struct.
-     */
-    isaac_uint_t stream_index;
-} isaac_ctx_t;
+    ISAAC_SNAPSHOT_COMPACT = 1,
+} isaac_snapshot_t;
 
 /**
- * Initialises the ISAAC CPRNG with a seed.
- *
- * The seed is copied value-wise into the ISAAC state, not byte-wise. That
- * means that a uint8_t array {1,2,3,4} is copied into the ctx->result[]
- * isaac_uint_t array as {1,2,3,4,0,...,0}, where each value is a isaac_uint_t
- * value.
- * Looking at the bytes and assuming little Endian byte order, the result is
- * {1,2,3,4} --> {1,0,0,0,2,0,0,0,3,0,0,0,4,0,0,0,0,...,0}.
- *
- * The reason behind this choice is to avoid issues with endianness; as ISAAC
- * works on isaac_uint_t values rather than their bytes, setting the
- * isaac_uint_t values and not their bytes, shall produce the same CPRNG stream
- * on architectures with different endianness.
- * An isaac_uint_t* could also be a valid choice as seed
- * input, but seeds are usually cryptographic keys and those are byte arrays,
- * so a developer could be confused on how to insert a uint8_t* seed into
- * a isaac_uint_t*.
- *
- * Maps to `void randinit(randctx *r, word flag)` from the original
- * implementation. Equivalent to a true `flag` with a seed provided. The
- * false `flag` is not available, as it should not be used for security
- * purposes.
- *
- * @warning
- * Failing to provide a seed (NULL or long 0 bytes), will make the whole CSPRNG
- * insecure as a zero-seed is used instead. This is only useful if a
- * **non-cryptographic** PRNG is required.
- *
- * @warning
- * Providing a seed with low entropy will result in the whole CSPRNG to be
- * weak.
- *
- * @param[in, out] ctx the ISAAC state to be initialised. Does nothing when
- * NULL.
- * @param[in] seed pointer to the seed to use, which is copied into the context.
- * - If NULL, then a zero seed is used instead (**insecure!**)
- * @param[in] seed_bytes amount of **bytes** in the seed, max
- * #ISAAC_SEED_MAX_BYTES.
- * - If 0, then a zero seed is used instead (**insecure!**)
- * - If > #ISAAC_SEED_MAX_BYTES, then only #ISAAC_SEED_MAX_BYTES will be used
- * - If < #ISAAC_SEED_MAX_BYTES, then the provided bytes will be used and the
- *   rest will be zero-padded.
+ * Size in bytes of each slab of memory of an #isaac_pool_t, the size of a
+ * huge page on x86-64 and many ARM systems.
  */
-void isaac_init(isaac_ctx_t* ctx, const uint8_t* seed, uint16_t seed_bytes);
+#define ISAAC_POOL_SLAB_BYTES (2U * 1024U * 1024U)
 
 /**
- * Provides the next pseudo-random integer.
- *
- * Because ISAAC works on 32 or 64 bit values, the stream is in integers
- * instead of bytes.
- * To convert them to bytes:
- * - get some values into a isaac_uint_t buffer with isaac_stream()
- * - allocate a uint8_t buffer
- * - convert the isaac_uint_t buffer to the uint8_t one using the utility
- *   functions isaac_to_little_endian() or isaac_to_big_endian() for little and
- *   big endian respectively.
- *
- * Every #ISAAC_ELEMENTS values generated it will automatically reshuffle
- * the ISAAC state to cache #ISAAC_ELEMENTS new elements. This means that
- * the first #ISAAC_ELEMENTS values after seeding are very cheap (just
- * copying values from the state) and the #ISAAC_ELEMENTS+1st value is
- * more expensive and so on.
- *
- * @param[in, out] ctx the ISAAC state, already initialised.
- * Does nothing when NULL.
- * @param[out] ints pseudo-random integers. Does nothing when NULL.
- * @param[in] amount quantity of 32-bit/64-bit integers to generate.
+ * Options of an #isaac_pool_t, combined with bitwise or.
  */
-void isaac_stream(isaac_ctx_t* ctx, isaac_uint_t* ints, size_t amount);
+typedef enum
+{
+    /** Plain memory, possibly swapped out and included in core dumps. */
+    ISAAC_POOL_DEFAULT = 0,
+    /** Slabs locked in RAM with `mlock()`, never swapped out. */
+    ISAAC_POOL_LOCKED = 1,
+    /** Slabs excluded from core dumps with `MADV_DONTDUMP`. */
+    ISAAC_POOL_NO_DUMP = 2,
+} isaac_pool_flags_t;
 
 /**
- * Safely erases the context.
- *
- * Useful to avoid leaking information about the seed or the state after
- * finishing using ISAAC.
- *
- * There is no need to call this function before using isaac_init(), including
- * when re-initing an existing context.
- *
- * @param[in, out] ctx the ISAAC state to cleanup. Does nothing when NULL.
+ * Name of an element of the API of the ISAAC variant #ISAAC_API_BITS,
+ * e.g. `ISAAC_API(init)` is `isaac64_init` when #ISAAC_API_BITS is 64.
  */
-void isaac_cleanup(isaac_ctx_t* ctx);
+#define ISAAC_API(name) ISAAC_API_CAT(isaac, ISAAC_API_BITS, _##name)
+/** @internal Expands the arguments of ISAAC_API_CAT_(). */
+#define ISAAC_API_CAT(prefix, bits, suffix) ISAAC_API_CAT_(prefix, bits, suffix)
+/** @internal Concatenates the parts of a name. */
+#define ISAAC_API_CAT_(prefix, bits, suffix) prefix##bits##suffix
 
+/*
+ * The names without bitness map to the variant #ISAAC_API_BITS, which is
+ * #ISAAC_BITS outside of this header.
+ */
+#define isaac_uint_t ISAAC_API(uint_t)
+#define isaac_ctx_t ISAAC_API(ctx_t)
+#define isaac_ctx_new ISAAC_API(ctx_new)
+#define isaac_ctx_free ISAAC_API(ctx_free)
+#define isaac_init ISAAC_API(init)
+#define isaac_init_many ISAAC_API(init_many)
+#define isaac_split ISAAC_API(split)
+#define isaac_clone ISAAC_API(clone)
+#define isaac_reseed ISAAC_API(reseed)
+#define isaac_stream ISAAC_API(stream)
+#define isaac_stream_nontemporal ISAAC_API(stream_nontemporal)
+#define isaac_stream_view ISAAC_API(stream_view)
+#define isaac_stream_consume ISAAC_API(stream_consume)
+#define isaac_discard ISAAC_API(discard)
+#define isaac_stream_bytes ISAAC_API(stream_bytes)
+#define isaac_stream_little_endian ISAAC_API(stream_little_endian)
+#define isaac_stream_big_endian ISAAC_API(stream_big_endian)
+#define isaac_cleanup ISAAC_API(cleanup)
+#define isaac_save ISAAC_API(save)
+#define isaac_load ISAAC_API(load)
+#define isaac_to_little_endian ISAAC_API(to_little_endian)
+#define isaac_to_big_endian ISAAC_API(to_big_endian)
+#define isaac_uniform_u32 ISAAC_API(uniform_u32)
+#define isaac_uniform_u64 ISAAC_API(uniform_u64)
+#define isaac_uniform_f64 ISAAC_API(uniform_f64)
+#define isaac_uniform_f32 ISAAC_API(uniform_f32)
+#define isaac_normal_f64 ISAAC_API(normal_f64)
+#define isaac_exponential_f64 ISAAC_API(exponential_f64)
+#define isaac_shuffle_array ISAAC_API(shuffle_array)
+#define isaac_permutation_u32 ISAAC_API(permutation_u32)
+#define isaac_reservoir_t ISAAC_API(reservoir_t)
+#define isaac_reservoir_init ISAAC_API(reservoir_init)
+#define isaac_reservoir_offer ISAAC_API(reservoir_offer)
+#define isaac_reservoir_skip ISAAC_API(reservoir_skip)
+#define isaac_sample_indices ISAAC_API(sample_indices)
+#define isaac_fill_parallel ISAAC_API(fill_parallel)
+#define isaac_buffered_ctx_t ISAAC_API(buffered_ctx_t)
+#define isaac_buffered_init ISAAC_API(buffered_init)
+#define isaac_buffered_stream ISAAC_API(buffered_stream)
+#define isaac_prefetch ISAAC_API(prefetch)
+#define isaac_buffered_start ISAAC_API(buffered_start)
+#define isaac_buffered_stop ISAAC_API(buffered_stop)
+#define isaac_buffered_cleanup ISAAC_API(buffered_cleanup)
+#define isaac_ring_s ISAAC_API(ring_s)
+#define isaac_ring_t ISAAC_API(ring_t)
+#define isaac_ring_new ISAAC_API(ring_new)
+#define isaac_ring_free ISAAC_API(ring_free)
+#define isaac_ring_watermarks ISAAC_API(ring_watermarks)
+#define isaac_ring_available ISAAC_API(ring_available)
+#define isaac_ring_fill ISAAC_API(ring_fill)
+#define isaac_ring_wait ISAAC_API(ring_wait)
+#define isaac_ring_start ISAAC_API(ring_start)
+#define isaac_ring_read ISAAC_API(ring_read)
+#define isaac_ring_read_bytes ISAAC_API(ring_read_bytes)
+#define isaac_pool_s ISAAC_API(pool_s)
+#define isaac_pool_t ISAAC_API(pool_t)
+#define isaac_pool_new ISAAC_API(pool_new)
+#define isaac_pool_acquire ISAAC_API(pool_acquire)
+#define isaac_pool_release ISAAC_API(pool_release)
+#define isaac_pool_in_use ISAAC_API(pool_in_use)
+#define isaac_pool_reset ISAAC_API(pool_reset)
+#define isaac_pool_free ISAAC_API(pool_free)
+#define isaac_lean_ctx_t ISAAC_API(lean_ctx_t)
+#define isaac_lean_init ISAAC_API(lean_init)
+#define isaac_lean_stream ISAAC_API(lean_stream)
+#define isaac_lean_cleanup ISAAC_API(lean_cleanup)
+#define isaac_x4_ctx_t ISAAC_API(x4_ctx_t)
+#define isaac_x4_init ISAAC_API(x4_init)
+#define isaac_x4_stream ISAAC_API(x4_stream)
+#define isaac_x4_cleanup ISAAC_API(x4_cleanup)
+#define isaac_x8_ctx_t ISAAC_API(x8_ctx_t)
+#define isaac_x8_init ISAAC_API(x8_init)
+#define isaac_x8_stream ISAAC_API(x8_stream)
+#define isaac_x8_cleanup ISAAC_API(x8_cleanup)
+
+/* Declares the API of both variants: isaac32_* and isaac64_*. */
+#define ISAAC_API_BITS 32
+#include "isaac_api.h"
+#undef ISAAC_API_BITS
+#define ISAAC_API_BITS 64
+#include "isaac_api.h"
+#undef ISAAC_API_BITS
 /**
- * Utility function, converting an array of 32-bit/64-bit integers into bytes
- * using **little endian** byte order.
+ * Bitness of the ISAAC variant used by the names without bitness: the
+ * default #ISAAC_BITS.
+ */
+#define ISAAC_API_BITS ISAAC_BITS
+
+/**
+ * Name of the kernels used by the functions having vectorised
+ * implementations, such as isaac_x4_stream(), isaac_x8_stream() and
+ * isaac_to_big_endian().
+ *
+ * LibISAAC is compiled for the baseline instruction set of its target; the
+ * kernels using wider instruction sets are picked at runtime, on the first
+ * call, according to what the running CPU supports. This allows to ship one
+ * binary that runs everywhere and is fast where possible.
+ *
+ * Possible names, from the most portable to the widest:
+ * - `"portable"`: plain C, any CPU
+ * - `"sse4"`: x86 with SSE4.1
+ * - `"avx2"`: x86 with AVX2
+ * - `"avx512"`: x86 with AVX-512F
+ * - `"neon"`: ARM with NEON
  *
- * Useful to convert a stream of 32-bit/64-bit integers to 8-bit values.
+ * The output of all kernels is the same, only their speed differs.
+ * The kernels are shared by both ISAAC variants.
  *
- * @param[out] bytes 8-bit integers. Must be at least \p amount_of_values*4
- * bytes long. Does nothing when NULL.
- * @param[in] values 32-bit/64-bit integers, as obtained from isaac_stream().
- * Does nothing when NULL.
- * @param[in] amount_of_values quantity of 32-bit/64-bit integers in the
- * \p values buffer.
+ * @return name of the kernels in use, never NULL.
  */
-void isaac_to_little_endian(uint8_t* bytes,
-                            const isaac_uint_t* values,
-                            size_t amount_of_values);
+const char* isaac_kernel_name(void);
 
 /**
- * Utility function, converting an array of 32-bit/64-bit integers into bytes
- * using **big endian** byte order.
+ * Forces the usage of the kernels with the given name, instead of the widest
+ * ones supported by the CPU.
  *
- * Useful to convert a stream of 32-bit/64-bit integers to 8-bit values.
+ * Mostly useful for benchmarking and testing. Affects all threads and all
+ * contexts.
  *
- * @param[out] bytes 8-bit integers. Must be at least \p amount_of_values*4
- * bytes long. Does nothing when NULL.
- * @param[in] values 32-bit/64-bit integers, as obtained from isaac_stream().
- * Does nothing when NULL.
- * @param[in] amount_of_values quantity of 32-bit/64-bit integers in the
- * \p values buffer.
+ * @param[in] name name of the kernels, as reported by isaac_kernel_name().
+ * If NULL, restores the automatic selection.
+ * @return true if the kernels are now in use, false if the name is unknown or
+ * not supported by the running CPU, in which case nothing changes.
  */
-void isaac_to_big_endian(uint8_t* bytes,
-                         const isaac_uint_t* values,
-                         size_t amount_of_values);
+bool isaac_kernel_select(const char* name);
 
 
 #ifdef __cplusplus
@@ -0,0 +1,1331 @@
+/**
+ * @file
+ *
+ * LibISAAC API of one ISAAC variant.
+ *
+ * Not a regular header: it is included by isaac.h once per variant, with
+ * #ISAAC_API_BITS set to 32 and then to 64. The names without bitness, such
+ * as isaac_init(), expand to the ones of the variant being declared, such as
+ * `isaac32_init()` and `isaac64_init()`. Include isaac.h instead.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+/**
+ * @property isaac_uint_t
+ * An integer or word used by ISAAC, either a uint32_t or uint64_t.
+ */
+#if (ISAAC_API_BITS == 32)
+typedef uint32_t isaac_uint_t;
+#else
+typedef uint64_t isaac_uint_t;
+#endif
+
+/**
+ * Context of the ISAAC CPRNG.
+ *
+ * No need to inspect it manually, use the functions instead.
+ *
+ * Maps to `randctx` from the original implementation.
+ */
+typedef struct
+{
+#if !ISAAC_CTX_ALIGNED
+    /**
+     * In this field the pseudo-random data is generated.
+     */
+    isaac_uint_t result[ISAAC_ELEMENTS];
+    /** Internal field. */
+    isaac_uint_t mem[ISAAC_ELEMENTS];
+    /** Internal field. */
+    isaac_uint_t a;
+#else
+    /** Internal field. */
+    alignas(ISAAC_CACHE_LINE) isaac_uint_t a;
+#endif
+    /** Internal field. */
+    isaac_uint_t b;
+    /** Internal field. */
+    isaac_uint_t c;
+    /**
+     * Index of the next value to output in the stream.
+     *
+     * Note: this value could be a uint16_t instead of a isaac_uint_t, but by
+     * using an isaac_uint_t we avoid any padding at the end of the struct.
+     */
+    isaac_uint_t stream_index;
+    /**
+     * Amount of bytes of `result[stream_index]` already output by
+     * isaac_stream_bytes(), 0 when none.
+     */
+    isaac_uint_t stream_byte;
+    /**
+     * Byte order of the partially output value, valid when `stream_byte`
+     * is not 0, one of #isaac_byte_order_t.
+     */
+    isaac_uint_t stream_byte_order;
+#if ISAAC_CTX_ALIGNED
+    /** Internal field, always 0, filling the cache line of the fields above. */
+    isaac_uint_t padding[ISAAC_CACHE_LINE / sizeof(isaac_uint_t) - 6U];
+    /**
+     * In this field the pseudo-random data is generated.
+     */
+    isaac_uint_t result[ISAAC_ELEMENTS];
+    /** Internal field. */
+    isaac_uint_t mem[ISAAC_ELEMENTS];
+#endif
+} isaac_ctx_t;
+
+/**
+ * Initialises the ISAAC CPRNG with a seed.
+ *
+ * The seed is copied value-wise into the ISAAC state, not byte-wise. That
+ * means that a uint8_t array {1,2,3,4} is copied into the ctx->result[]
+ * isaac_uint_t array as {1,2,3,4,0,...,0}, where each value is a isaac_uint_t
+ * value.
+ * Looking at the bytes and assuming little Endian byte order, the result is
+ * {1,2,3,4} --> {1,0,0,0,2,0,0,0,3,0,0,0,4,0,0,0,0,...,0}.
+ *
+ * The reason behind this choice is to avoid issues with endianness; as ISAAC
+ * works on isaac_uint_t values rather than their bytes, setting the
+ * isaac_uint_t values and not their bytes, shall produce the same CPRNG stream
+ * on architectures with different endianness.
+ * An isaac_uint_t* could also be a valid choice as seed
+ * input, but seeds are usually cryptographic keys and those are byte arrays,
+ * so a developer could be confused on how to insert a uint8_t* seed into
+ * a isaac_uint_t*.
+ *
+ * Maps to `void randinit(randctx *r, word flag)` from the original
+ * implementation. Equivalent to a true `flag` with a seed provided. The
+ * false `flag` is not available, as it should not be used for security
+ * purposes.
+ *
+ * @warning
+ * Failing to provide a seed (NULL or long 0 bytes), will make the whole CSPRNG
+ * insecure as a zero-seed is used instead. This is only useful if a
+ * **non-cryptographic** PRNG is required.
+ *
+ * @warning
+ * Providing a seed with low entropy will result in the whole CSPRNG to be
+ * weak.
+ *
+ * @param[in, out] ctx the ISAAC state to be initialised. Does nothing when
+ * NULL.
+ * @param[in] seed pointer to the seed to use, which is copied into the context.
+ * - If NULL, then a zero seed is used instead (**insecure!**)
+ * @param[in] seed_bytes amount of **bytes** in the seed, max
+ * #ISAAC_SEED_MAX_BYTES.
+ * - If 0, then a zero seed is used instead (**insecure!**)
+ * - If > #ISAAC_SEED_MAX_BYTES, then only #ISAAC_SEED_MAX_BYTES will be used
+ * - If < #ISAAC_SEED_MAX_BYTES, then the provided bytes will be used and the
+ *   rest will be zero-padded.
+ */
+void isaac_init(isaac_ctx_t* ctx, const uint8_t* seed, uint16_t seed_bytes);
+
+/**
+ * Allocates and initialises an ISAAC CPRNG with a seed, as isaac_init()
+ * does, aligned to #ISAAC_CACHE_LINE bytes.
+ *
+ * With #ISAAC_CTX_ALIGNED, contexts on the stack or in static memory are
+ * aligned as well; this allocator also aligns the ones on the heap, which
+ * `malloc()` does not.
+ *
+ * @param[in] seed pointer to the seed to use, as in isaac_init().
+ * @param[in] seed_bytes amount of **bytes** in the seed, as in isaac_init().
+ * @return the new context, to be released with isaac_ctx_free(), or NULL
+ * when out of memory.
+ */
+isaac_ctx_t* isaac_ctx_new(const uint8_t* seed, uint16_t seed_bytes);
+
+/**
+ * Erases with isaac_cleanup() and releases a context allocated with
+ * isaac_ctx_new().
+ *
+ * @param[in, out] ctx the ISAAC state to release. Does nothing when NULL.
+ */
+void isaac_ctx_free(isaac_ctx_t* ctx);
+
+/**
+ * Initialises many ISAAC CPRNGs at once, each with its own seed, giving
+ * exactly the same contexts as calling isaac_init() on each of them.
+ *
+ * Meant for the startup of programs creating thousands of generators, e.g.
+ * one per connection. The contexts are processed in groups of
+ * #ISAAC_X8_LANES, initialising and reshuffling them together as the lanes of
+ * a #isaac_x8_ctx_t with AVX2 or AVX-512 instructions; the last few contexts
+ * not filling a group are initialised one by one. On CPUs without those
+ * kernels all contexts are initialised one by one.
+ *
+ * @param[out] ctxs array of \p count ISAAC states to be initialised. Does
+ * nothing when NULL.
+ * @param[in] seeds array of \p count seeds, as in isaac_init(). When NULL, all
+ * contexts use a zero seed (**insecure!**). A NULL seed uses a zero seed for
+ * its context only.
+ * @param[in] seed_bytes array of \p count seed lengths, as in isaac_init().
+ * When NULL, all contexts use a zero seed (**insecure!**).
+ * @param[in] count amount of contexts to initialise.
+ */
+void isaac_init_many(isaac_ctx_t* ctxs,
+                     const uint8_t* const* seeds,
+                     const uint16_t* seed_bytes,
+                     size_t count);
+
+/**
+ * Derives a new ISAAC CPRNG from an existing one and a label, much faster
+ * than initialising it with isaac_init().
+ *
+ * Meant to give each of many tasks its own generator. The child state is
+ * one mixing pass over the parent's state, keyed with the label and with 8
+ * integers taken from the parent's stream, followed by the reshuffle
+ * generating its first batch: isaac_init() takes a scramble, two mixing
+ * passes and the same reshuffle.
+ *
+ * The parent advances by 8 integers, so splitting it twice, even with the
+ * same label, gives different children. Given the same parent state and
+ * label, the child is always the same one, so splits are reproducible.
+ *
+ * @warning
+ * The child is derived from the secret state of the parent: treat it with
+ * the same care as the parent. The children are statistically independent
+ * streams, but a child should not be handed to a party that must not learn
+ * anything about the parent.
+ *
+ * @param[in, out] parent the ISAAC state to derive from, already
+ * initialised. Does nothing when NULL.
+ * @param[out] child the ISAAC state to initialise. Does nothing when NULL or
+ * the same as \p parent.
+ * @param[in] label any value distinguishing the child, e.g. a task index.
+ */
+void isaac_split(isaac_ctx_t* parent, isaac_ctx_t* child, uint64_t label);
+
+/**
+ * Copies an ISAAC CPRNG exactly: both provide the same stream afterwards.
+ *
+ * @param[out] dst the copy. Does nothing when NULL or the same as \p src.
+ * @param[in] src the ISAAC state to copy. Does nothing when NULL.
+ */
+void isaac_clone(isaac_ctx_t* dst, const isaac_ctx_t* src);
+
+/**
+ * Mixes fresh entropy into an ISAAC CPRNG in use, e.g. at every key rotation,
+ * much faster than initialising it again with isaac_init().
+ *
+ * The entropy is absorbed by the mixing function 8 integers at the time,
+ * then a single mixing pass folds it into the whole state: every byte of the
+ * entropy affects every integer of the state, together with the previous
+ * state, which is not discarded. No reshuffle happens.
+ *
+ * The integers of the current batch not output yet, already generated from
+ * the previous state, are still output first, so the stream stays
+ * consistent; the next batches come from the reseeded state. To start using
+ * the reseeded state right away, discard the rest of the batch with
+ * isaac_stream_view() and isaac_stream_consume().
+ *
+ * The result is the same on hosts of any byte order: the entropy is read as
+ * little endian integers, zero-padded at the end.
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[in] entropy fresh random bytes. Does nothing when NULL.
+ * @param[in] entropy_bytes amount of bytes in \p entropy, any length.
+ * Does nothing when 0.
+ */
+void isaac_reseed(isaac_ctx_t* ctx,
+                  const uint8_t* entropy,
+                  size_t entropy_bytes);
+
+/**
+ * Provides the next pseudo-random integer.
+ *
+ * Because ISAAC works on 32 or 64 bit values, the stream is in integers
+ * instead of bytes.
+ * To convert them to bytes:
+ * - get some values into a isaac_uint_t buffer with isaac_stream()
+ * - allocate a uint8_t buffer
+ * - convert the isaac_uint_t buffer to the uint8_t one using the utility
+ *   functions isaac_to_little_endian() or isaac_to_big_endian() for little and
+ *   big endian respectively.
+ *
+ * Every #ISAAC_ELEMENTS values generated it will automatically reshuffle
+ * the ISAAC state to cache #ISAAC_ELEMENTS new elements. This means that
+ * the first #ISAAC_ELEMENTS values after seeding are very cheap (just
+ * copying values from the state) and the #ISAAC_ELEMENTS+1st value is
+ * more expensive and so on.
+ *
+ * If isaac_stream_bytes() left an integer partially output, its remaining
+ * bytes are skipped, so no byte is output twice.
+ *
+ * Large requests are generated directly into \p ints one whole batch of
+ * #ISAAC_ELEMENTS values at the time, without passing through the context,
+ * so every value is written only once.
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[out] ints pseudo-random integers. Does nothing when NULL.
+ * @param[in] amount quantity of 32-bit/64-bit integers to generate.
+ */
+void isaac_stream(isaac_ctx_t* ctx, isaac_uint_t* ints, size_t amount);
+
+/**
+ * Provides the next pseudo-random integers, writing them with non-temporal
+ * stores, which bypass the CPU caches.
+ *
+ * Same output as isaac_stream(), meant for filling buffers much larger than
+ * the caches (several MiB), e.g. when wiping disks or creating test data:
+ * the output does not evict useful data from the caches and is not read
+ * before being overwritten. For smaller buffers, that are likely to be used
+ * soon after, isaac_stream() is faster.
+ *
+ * On CPUs without non-temporal stores (anything but x86-64 currently), it's
+ * the same as isaac_stream().
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[out] ints pseudo-random integers. Does nothing when NULL.
+ * @param[in] amount quantity of 32-bit/64-bit integers to generate.
+ */
+void isaac_stream_nontemporal(isaac_ctx_t* ctx,
+                              isaac_uint_t* ints,
+                              size_t amount);
+
+/**
+ * Lends the caller the next pseudo-random integers, without copying them.
+ *
+ * Provides a pointer to the part of the current batch of #ISAAC_ELEMENTS
+ * integers that has not been output yet, so the caller can read them in place.
+ * The integers are the same ones isaac_stream() would provide next.
+ * Reading them does not advance the stream: call isaac_stream_consume()
+ * with the amount of integers actually used, before the next call to any
+ * other function using the same context, as they may overwrite the batch.
+ *
+ * Example:
+ * ```
+ * size_t available;
+ * const isaac_uint_t* ints = isaac_stream_view(&ctx, &available);
+ * use(ints, 3);  // available is always >= 1
+ * isaac_stream_consume(&ctx, 3);
+ * ```
+ *
+ * If isaac_stream_bytes() left an integer partially output, its remaining
+ * bytes are skipped, so no byte is output twice.
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Returns NULL when NULL.
+ * @param[out] available amount of integers that can be read from the
+ * returned pointer, between 1 and #ISAAC_ELEMENTS. Returns NULL when NULL.
+ * Set to 0 when the returned pointer is NULL.
+ * @return pointer to the next pseudo-random integers, valid until the next
+ * call to a function using \p ctx, or NULL on NULL arguments.
+ */
+const isaac_uint_t* isaac_stream_view(isaac_ctx_t* ctx, size_t* available);
+
+/**
+ * Marks integers lent by isaac_stream_view() as used, advancing the stream.
+ *
+ * When the whole batch has been consumed, the ISAAC state is reshuffled to
+ * prepare the next one, exactly as isaac_stream() does.
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[in] amount quantity of integers used. Values greater than the amount
+ * available from isaac_stream_view() are reduced to it.
+ */
+void isaac_stream_consume(isaac_ctx_t* ctx, size_t amount);
+
+/**
+ * Advances the stream by the given amount of integers without outputting
+ * them, e.g. to jump to a position of the stream for a replay.
+ *
+ * Same as isaac_stream() into a buffer of \p amount integers to be thrown
+ * away, but without the buffer: the integers left in the current batch are
+ * skipped in constant time and each skipped whole batch costs only the
+ * reshuffle of the state, with no output written.
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[in] amount quantity of integers to skip.
+ */
+void isaac_discard(isaac_ctx_t* ctx, uint64_t amount);
+
+/**
+ * Provides the next pseudo-random bytes.
+ *
+ * The integers of the stream are converted to bytes in the given byte order,
+ * as isaac_to_little_endian() or isaac_to_big_endian() would do, without the
+ * need for an intermediate buffer of integers.
+ *
+ * Any amount of bytes can be requested. When it's not a multiple of
+ * `sizeof(isaac_uint_t)`, the remaining bytes of the last integer are kept in
+ * the context and output first by the next call, so no generated byte is
+ * discarded: consecutive calls provide the same bytes as a single call of
+ * their total length.
+ *
+ * The remaining bytes of a partially output integer are discarded only if
+ * the next call uses the other byte order, or if the next call is to a
+ * function providing integers, such as isaac_stream(). This guarantees that
+ * no byte is ever output twice.
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[out] bytes pseudo-random bytes, at least \p amount long.
+ * Does nothing when NULL.
+ * @param[in] amount quantity of bytes to generate.
+ * @param[in] order byte order of the conversion of the integers to bytes.
+ * Does nothing when not a valid #isaac_byte_order_t.
+ */
+void isaac_stream_bytes(isaac_ctx_t* ctx,
+                        uint8_t* bytes,
+                        size_t amount,
+                        isaac_byte_order_t order);
+
+/**
+ * Provides the next pseudo-random bytes, serialising each integer in
+ * **little endian** byte order.
+ *
+ * Same as isaac_stream_bytes() with #ISAAC_LITTLE_ENDIAN: whole batches of
+ * #ISAAC_ELEMENTS integers are written as bytes directly while being
+ * generated, without an intermediate isaac_uint_t buffer or a second pass
+ * over the output as with isaac_stream() followed by isaac_to_little_endian().
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[out] bytes pseudo-random bytes, at least \p amount long.
+ * Does nothing when NULL.
+ * @param[in] amount quantity of bytes to generate.
+ */
+void isaac_stream_little_endian(isaac_ctx_t* ctx,
+                                uint8_t* bytes,
+                                size_t amount);
+
+/**
+ * Same as isaac_stream_little_endian(), in **big endian** byte order.
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[out] bytes pseudo-random bytes, at least \p amount long.
+ * Does nothing when NULL.
+ * @param[in] amount quantity of bytes to generate.
+ */
+void isaac_stream_big_endian(isaac_ctx_t* ctx,
+                             uint8_t* bytes,
+                             size_t amount);
+
+/**
+ * Safely erases the context.
+ *
+ * Useful to avoid leaking information about the seed or the state after
+ * finishing using ISAAC.
+ *
+ * There is no need to call this function before using isaac_init(), including
+ * when re-initing an existing context.
+ *
+ * @param[in, out] ctx the ISAAC state to cleanup. Does nothing when NULL.
+ */
+void isaac_cleanup(isaac_ctx_t* ctx);
+
+/**
+ * Saves the state of an ISAAC CPRNG into a snapshot, from which isaac_load()
+ * resumes exactly the same stream, e.g. to checkpoint a simulation.
+ *
+ * The snapshot is a versioned byte format, independent of the layout of the
+ * context and of the byte order of the host, ending with a CRC-32 checksum.
+ * It records the ISAAC variant: a snapshot of the 32 bit variant can not be
+ * loaded by the 64 bit one and vice versa.
+ *
+ * A #ISAAC_SNAPSHOT_COMPACT snapshot omits the values of the current batch
+ * already output, which the stream never outputs again. The more of the batch
+ * was used, the smaller it is: from the size of a #ISAAC_SNAPSHOT_FULL one
+ * down to about half of it.
+ *
+ * @warning
+ * The snapshot holds the secret state of the generator: treat it with the
+ * same care as the seed.
+ *
+ * @param[in] ctx the ISAAC state to save. Returns 0 when NULL.
+ * @param[out] bytes buffer the snapshot is written into. When NULL, nothing
+ * is written and the size of the snapshot is returned instead.
+ * @param[in] max_bytes size of \p bytes. At most #ISAAC_SNAPSHOT_MAX_BYTES
+ * are ever needed. Returns 0 when too small for the snapshot.
+ * @param[in] kind kind of snapshot, one of #isaac_snapshot_t. Returns 0 when
+ * not one of them.
+ * @return the size of the snapshot in bytes, 0 when nothing was written.
+ */
+size_t isaac_save(const isaac_ctx_t* ctx,
+                  uint8_t* bytes,
+                  size_t max_bytes,
+                  isaac_snapshot_t kind);
+
+/**
+ * Restores the state of an ISAAC CPRNG from a snapshot written by
+ * isaac_save(), continuing the stream exactly where it was saved.
+ *
+ * The snapshot is validated before touching the context: on failure the
+ * context is unchanged.
+ *
+ * @param[out] ctx the ISAAC state to restore. Returns false when NULL.
+ * @param[in] bytes the snapshot. Returns false when NULL.
+ * @param[in] size amount of bytes in \p bytes, at least the size of the
+ * snapshot. The bytes following the snapshot are ignored.
+ * @return true when the context was restored, false when the snapshot is
+ * truncated, corrupted, of another version or of the other ISAAC variant.
+ */
+bool isaac_load(isaac_ctx_t* ctx, const uint8_t* bytes, size_t size);
+
+/**
+ * Utility function, converting an array of 32-bit/64-bit integers into bytes
+ * using **little endian** byte order.
+ *
+ * Useful to convert a stream of 32-bit/64-bit integers to 8-bit values.
+ *
+ * When the byte order matches the one of the host, this is a plain copy,
+ * otherwise the bytes of each integer are reversed, using vector byte
+ * shuffles where the CPU supports them.
+ *
+ * @param[out] bytes 8-bit integers. Must be at least \p amount_of_values*4
+ * bytes long. Does nothing when NULL. May be the same buffer as \p values to
+ * convert in place, but must not overlap it otherwise.
+ * @param[in] values 32-bit/64-bit integers, as obtained from isaac_stream().
+ * Does nothing when NULL.
+ * @param[in] amount_of_values quantity of 32-bit/64-bit integers in the
+ * \p values buffer.
+ */
+void isaac_to_little_endian(uint8_t* bytes,
+                            const isaac_uint_t* values,
+                            size_t amount_of_values);
+
+/**
+ * Utility function, converting an array of 32-bit/64-bit integers into bytes
+ * using **big endian** byte order.
+ *
+ * Useful to convert a stream of 32-bit/64-bit integers to 8-bit values.
+ *
+ * When the byte order matches the one of the host, this is a plain copy,
+ * otherwise the bytes of each integer are reversed, using vector byte
+ * shuffles where the CPU supports them.
+ *
+ * @param[out] bytes 8-bit integers. Must be at least \p amount_of_values*4
+ * bytes long. Does nothing when NULL. May be the same buffer as \p values to
+ * convert in place, but must not overlap it otherwise.
+ * @param[in] values 32-bit/64-bit integers, as obtained from isaac_stream().
+ * Does nothing when NULL.
+ * @param[in] amount_of_values quantity of 32-bit/64-bit integers in the
+ * \p values buffer.
+ */
+void isaac_to_big_endian(uint8_t* bytes,
+                         const isaac_uint_t* values,
+                         size_t amount_of_values);
+
+/**
+ * Provides uniformly distributed pseudo-random 32 bit integers in
+ * [0, \p bound), without bias.
+ *
+ * Unlike the common `value % bound`, every integer in the range is exactly
+ * equally likely. Lemire's nearly-divisionless multiply-shift method is used:
+ * each integer costs a multiplication and rarely a division; the few values
+ * of the stream that would introduce a bias are rejected.
+ *
+ * The random bits are taken from the stream, exactly as isaac_stream() does,
+ * including the rejected ones. With ISAAC-64 each integer of the stream
+ * provides two 32 bit values, lower half first; an unused upper half at the
+ * end of the call is discarded. Large amounts are processed with vector
+ * instructions, when available, with the same output.
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[out] out bounded integers, at least \p count long.
+ * Does nothing when NULL.
+ * @param[in] count quantity of integers to generate.
+ * @param[in] bound exclusive upper limit of the integers.
+ * Does nothing when 0.
+ */
+void isaac_uniform_u32(isaac_ctx_t* ctx,
+                       uint32_t* out,
+                       size_t count,
+                       uint32_t bound);
+
+/**
+ * Same as isaac_uniform_u32(), for 64 bit integers.
+ *
+ * With ISAAC each 64 bit value is made of two integers of the stream, the
+ * first one being the upper half.
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[out] out bounded integers, at least \p count long.
+ * Does nothing when NULL.
+ * @param[in] count quantity of integers to generate.
+ * @param[in] bound exclusive upper limit of the integers.
+ * Does nothing when 0.
+ */
+void isaac_uniform_u64(isaac_ctx_t* ctx,
+                       uint64_t* out,
+                       size_t count,
+                       uint64_t bound);
+
+/**
+ * Provides uniformly distributed pseudo-random doubles in [0, 1).
+ *
+ * Each double is built from the upper 53 bits of 64 random bits, so every
+ * multiple of 2^-53 in [0, 1) is equally likely: the full precision of the
+ * mantissa, without divisions. The random bits are taken from the stream,
+ * exactly as isaac_stream() does: one integer per double with ISAAC-64, two
+ * with ISAAC, the first one being the upper half. Large amounts are
+ * converted with vector instructions, when available, with the same output.
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[out] out doubles, at least \p count long. Does nothing when NULL.
+ * @param[in] count quantity of doubles to generate.
+ */
+void isaac_uniform_f64(isaac_ctx_t* ctx, double* out, size_t count);
+
+/**
+ * Provides uniformly distributed pseudo-random floats in [0, 1).
+ *
+ * Same as isaac_uniform_f64(), with the upper 24 of 32 random bits, so every
+ * multiple of 2^-24 in [0, 1) is equally likely. With ISAAC-64 each integer
+ * of the stream provides two floats, lower half first; an unused upper half
+ * at the end of the call is discarded.
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[out] out floats, at least \p count long. Does nothing when NULL.
+ * @param[in] count quantity of floats to generate.
+ */
+void isaac_uniform_f32(isaac_ctx_t* ctx, float* out, size_t count);
+
+/**
+ * Provides pseudo-random doubles with the standard normal distribution:
+ * mean 0, standard deviation 1.
+ *
+ * For a mean `mu` and a standard deviation `sigma`, use `mu + sigma * x`.
+ *
+ * Sampled with the ziggurat method of Marsaglia and Tsang, with 256 layers:
+ * about 99% of the samples cost a single 64 bit integer of the stream, a
+ * table lookup and a multiplication, without `log()`, `sqrt()` or `cos()`.
+ * The rest take more integers of the stream and call `exp()` or `log()`.
+ * The fast path runs with vector instructions, when available, with the same
+ * output. With ISAAC, each 64 bit integer is made of two integers of the
+ * stream, the first one being the upper half.
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[out] out samples, at least \p count long. Does nothing when NULL.
+ * @param[in] count quantity of samples to generate.
+ */
+void isaac_normal_f64(isaac_ctx_t* ctx, double* out, size_t count);
+
+/**
+ * Provides pseudo-random doubles with the exponential distribution of
+ * rate 1, i.e. mean 1.
+ *
+ * For a rate `lambda`, use `x / lambda`.
+ *
+ * Sampled with the ziggurat method, as isaac_normal_f64() does.
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[out] out samples, at least \p count long. Does nothing when NULL.
+ * @param[in] count quantity of samples to generate.
+ */
+void isaac_exponential_f64(isaac_ctx_t* ctx, double* out, size_t count);
+
+/**
+ * Shuffles an array in place into a uniformly random order.
+ *
+ * Fisher-Yates shuffle: from the last element down to the second one, each is
+ * swapped with an element at a position drawn without bias among the ones
+ * up to it. The random bits of each position depend on its own bound, the
+ * amount of elements up to the swapped one included: a bound of at most 2^32
+ * takes 32 bits, as isaac_uniform_u32() does, and a larger one takes 64 bits,
+ * as isaac_uniform_u64() does. So an array of more than 2^32 elements starts
+ * with 64 bit positions and continues with 32 bit ones from the element at
+ * index 2^32 - 1 down. With ISAAC-64, 32 bits are half an integer of the
+ * stream, with ISAAC 64 bits are two integers.
+ *
+ * Arrays larger than a few MiB, likely exceeding the last level cache,
+ * have the elements to swap prefetched some steps in advance, hiding the
+ * memory latency of the random accesses. The result is the same.
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[in, out] base the array to shuffle. Does nothing when NULL.
+ * @param[in] count quantity of elements in the array.
+ * Does nothing when less than 2.
+ * @param[in] elem_size size of each element in bytes.
+ * Does nothing when 0.
+ */
+void isaac_shuffle_array(isaac_ctx_t* ctx,
+                         void* base,
+                         size_t count,
+                         size_t elem_size);
+
+/**
+ * Provides a uniformly random permutation of the integers `[0, n)`.
+ *
+ * Built in a single pass with the "inside-out" Fisher-Yates algorithm: each
+ * integer `i` is placed at a position drawn without bias among the first
+ * `i + 1`, moving the one there to the end. Large outputs are prefetched as
+ * in isaac_shuffle_array().
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[out] out the permutation, at least \p n long.
+ * Does nothing when NULL.
+ * @param[in] n quantity of integers to permute.
+ */
+void isaac_permutation_u32(isaac_ctx_t* ctx, uint32_t* out, uint32_t n);
+
+/**
+ * Reservoir sampler, picking \p k items uniformly at random from a stream of
+ * items of unknown length, each sample of \p k items being equally likely.
+ *
+ * Uses Li's algorithm L: after the reservoir is full, the amount of items
+ * to skip before the next one entering it is drawn directly, so the random
+ * draws grow with `k * log(n / k)` for a stream of `n` items, rather than
+ * with `n`.
+ *
+ * The reservoir itself is kept by the caller: the sampler only tells where
+ * each item goes.
+ *
+ * Reference: K.-H. Li, "Reservoir-Sampling Algorithms of Time Complexity
+ * O(n(1 + log(N/n)))", ACM Transactions on Mathematical Software, 1994.
+ */
+typedef struct
+{
+    /** ISAAC state the random numbers are drawn from. */
+    isaac_ctx_t* ctx;
+    /** Capacity of the reservoir. */
+    size_t k;
+    /** Amount of items offered or skipped so far. */
+    uint64_t seen;
+    /** Index of the next item entering the full reservoir. */
+    uint64_t next;
+    /** Algorithm L's weight, decreasing with each item entering. */
+    double w;
+} isaac_reservoir_t;
+
+/**
+ * Initialises a reservoir sampler with an empty reservoir.
+ *
+ * The sampler draws from the stream of \p ctx at every item entering the
+ * full reservoir, so the context must outlive it.
+ *
+ * @param[out] res the sampler to initialise. Does nothing when NULL.
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[in] k capacity of the reservoir. When 0, no item enters it.
+ */
+void isaac_reservoir_init(isaac_reservoir_t* res, isaac_ctx_t* ctx, size_t k);
+
+/**
+ * Offers the next item of the stream to the reservoir.
+ *
+ * The first \p k items fill the slots in order. Afterwards, each item either
+ * replaces the item in a random slot or is skipped; only the former costs
+ * random numbers.
+ *
+ * @param[in, out] res the sampler. Does nothing when NULL.
+ * @return the slot in `[0, k)` where to store the item, replacing the
+ * previous one, or #ISAAC_RESERVOIR_SKIP when the item does not enter the
+ * reservoir.
+ */
+size_t isaac_reservoir_offer(isaac_reservoir_t* res);
+
+/**
+ * Passes over the next items of the stream without offering them, as long as
+ * none of them would enter the reservoir.
+ *
+ * Allows to skip whole batches, or to seek over them, in constant time.
+ * Passing over the skipped items with isaac_reservoir_offer() gives the same
+ * result.
+ *
+ * @param[in, out] res the sampler. Does nothing when NULL.
+ * @param[in] amount the maximum amount of items to pass over.
+ * @return the amount of items passed over, up to \p amount. The item after
+ * them is the next one to offer. 0 while the reservoir is not full.
+ */
+uint64_t isaac_reservoir_skip(isaac_reservoir_t* res, uint64_t amount);
+
+/**
+ * Provides \p k distinct indices in `[0, n)`, picked uniformly at random and
+ * sorted in increasing order.
+ *
+ * Uses Vitter's algorithm D, drawing the gap between consecutive indices in
+ * constant expected time: the time and the random draws grow with \p k,
+ * not with \p n. Samples denser than 1 index out of 13 switch to
+ * Vitter's algorithm A, taking time proportional to \p n, i.e. still to
+ * \p k. With \p n above 2^53, the gaps are computed with slightly less
+ * than their full precision.
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[in] n quantity of indices to pick from.
+ * @param[in] k quantity of indices to pick. Does nothing when 0 or greater
+ * than \p n.
+ * @param[out] out the indices, at least \p k long. Does nothing when NULL.
+ */
+void isaac_sample_indices(isaac_ctx_t* ctx,
+                          uint64_t n,
+                          size_t k,
+                          uint64_t* out);
+
+/**
+ * Fills a buffer with pseudo-random integers using many threads, with an
+ * output depending only on the seed.
+ *
+ * The buffer is split into chunks of #ISAAC_FILL_CHUNK_WORDS integers. Chunk
+ * `i` is the stream of an ISAAC state initialised with a seed made of the
+ * first `ISAAC_SEED_MAX_BYTES - 8` bytes of \p master_seed, zero-padded,
+ * followed by the 8 bytes of `i` in little endian, so each chunk is an
+ * independent substream. The threads take the chunks one at the time from a
+ * shared queue until none is left, so the work is balanced and the output is
+ * the same with any amount of threads.
+ *
+ * The output differs from the one of a single isaac_stream() call with the
+ * same seed.
+ *
+ * When the library is built without threads support, the calling thread
+ * generates all chunks, with the same output.
+ *
+ * @warning
+ * The same considerations on the seed as for isaac_init() apply: a NULL
+ * master seed is **insecure**.
+ *
+ * @param[in] master_seed seed of the whole buffer. Zero seed when NULL.
+ * @param[in] seed_bytes amount of bytes in \p master_seed. Only the first
+ * `ISAAC_SEED_MAX_BYTES - 8` are used.
+ * @param[out] out pseudo-random integers. Does nothing when NULL.
+ * @param[in] words quantity of 32-bit/64-bit integers to generate.
+ * @param[in] threads amount of threads generating the chunks, including the
+ * calling one, up to #ISAAC_FILL_MAX_THREADS. 0 and 1 use the calling thread
+ * only.
+ */
+void isaac_fill_parallel(const uint8_t* master_seed,
+                         uint16_t seed_bytes,
+                         isaac_uint_t* out,
+                         size_t words,
+                         size_t threads);
+
+/**
+ * Double-buffered context of the ISAAC CPRNG, generating the next batch of
+ * #ISAAC_ELEMENTS integers ahead of time, while the current one is read.
+ *
+ * With an #isaac_ctx_t, every #ISAAC_ELEMENTS-th integer costs a whole
+ * reshuffle of the state. Here the next batch is generated into the spare
+ * bank by isaac_prefetch(), called at a convenient time, or continuously by
+ * a helper thread started with isaac_buffered_start(), so the caller of
+ * isaac_buffered_stream() only copies integers. When the spare bank is not
+ * ready yet, it is generated inline, as with an #isaac_ctx_t.
+ *
+ * The stream is the same one of an #isaac_ctx_t with the same seed.
+ *
+ * No need to inspect it manually, use the functions instead.
+ */
+typedef struct
+{
+    /** The batch being read and the next one. */
+    isaac_uint_t banks[2][ISAAC_ELEMENTS];
+    /** ISAAC state generating the batches after the ones in the banks. */
+    isaac_ctx_t generator;
+    /** Helper thread filling the spare bank, NULL when not running. */
+    void* helper;
+    /** Index of the bank being read, 0 or 1. */
+    size_t active;
+    /** Index of the next integer to output from the bank being read. */
+    size_t index;
+    /** Whether the other bank is empty, being filled or ready. */
+    size_t spare;
+} isaac_buffered_ctx_t;
+
+/**
+ * Initialises a double-buffered ISAAC CPRNG with a seed, without helper
+ * thread.
+ *
+ * Same seeding as isaac_init(), with the same warnings.
+ *
+ * @param[out] bctx the double-buffered context to initialise.
+ * Does nothing when NULL.
+ * @param[in] seed pointer to the seed to use, as in isaac_init().
+ * @param[in] seed_bytes amount of **bytes** in the seed, as in isaac_init().
+ */
+void isaac_buffered_init(isaac_buffered_ctx_t* bctx,
+                         const uint8_t* seed,
+                         uint16_t seed_bytes);
+
+/**
+ * Provides the next pseudo-random integers, the same ones isaac_stream()
+ * provides for a context with the same seed.
+ *
+ * Each time the batch being read runs out, the spare one takes its place:
+ * waiting for the helper thread to complete it, if it's generating it, or
+ * generating it inline, if nobody did.
+ *
+ * @param[in, out] bctx the double-buffered context, already initialised.
+ * Does nothing when NULL.
+ * @param[out] ints pseudo-random integers. Does nothing when NULL.
+ * @param[in] amount quantity of 32-bit/64-bit integers to generate.
+ */
+void isaac_buffered_stream(isaac_buffered_ctx_t* bctx,
+                           isaac_uint_t* ints,
+                           size_t amount);
+
+/**
+ * Generates the next batch into the spare bank, so the next
+ * #ISAAC_ELEMENTS integers after the current batch cost no reshuffle.
+ *
+ * Meant to be called at a convenient time, e.g. when idle between requests.
+ * Does nothing when the spare bank is already ready, so calling it often is
+ * cheap.
+ *
+ * @param[in, out] bctx the double-buffered context, already initialised.
+ * Does nothing when NULL or while a helper thread is running.
+ */
+void isaac_prefetch(isaac_buffered_ctx_t* bctx);
+
+/**
+ * Starts a helper thread, refilling the spare bank every time the caller
+ * moves to it.
+ *
+ * While running, isaac_buffered_stream() must be called from one thread at
+ * the time, as for any context. isaac_buffered_stop() or
+ * isaac_buffered_cleanup() must be called before the context goes out of
+ * scope or is moved.
+ *
+ * @param[in, out] bctx the double-buffered context, already initialised.
+ * Returns false when NULL.
+ * @return true when the helper thread is running, also if it already was;
+ * false when it could not be started or the library was built without
+ * threads support.
+ */
+bool isaac_buffered_start(isaac_buffered_ctx_t* bctx);
+
+/**
+ * Stops the helper thread, waiting for it to end. The spare bank, if ready,
+ * is kept.
+ *
+ * @param[in, out] bctx the double-buffered context.
+ * Does nothing when NULL or without helper thread.
+ */
+void isaac_buffered_stop(isaac_buffered_ctx_t* bctx);
+
+/**
+ * Stops the helper thread, if any, and safely erases the context.
+ *
+ * @param[in, out] bctx the double-buffered context. Does nothing when NULL.
+ */
+void isaac_buffered_cleanup(isaac_buffered_ctx_t* bctx);
+
+/**
+ * Ring buffer of pre-generated pseudo-random integers, filled by one producer
+ * thread and read by any amount of consumer threads without locks.
+ *
+ * The producer generates whole batches of #ISAAC_ELEMENTS integers into the
+ * ring with isaac_ring_fill() until the high watermark, then sleeps in
+ * isaac_ring_wait() until the consumers drain the ring to the low watermark.
+ * The producer can also be a thread of the library, started with
+ * isaac_ring_start(). The consumers take integers with isaac_ring_read() or
+ * bytes with isaac_ring_read_bytes(), claiming them with a single atomic
+ * compare-and-swap; they take the mutex only to wake up the producer.
+ *
+ * The integers are the stream of an #isaac_ctx_t with the same seed, split
+ * among the consumers in the order they take them.
+ *
+ * Opaque: created with isaac_ring_new(), destroyed with isaac_ring_free().
+ */
+typedef struct isaac_ring_s isaac_ring_t;
+
+/**
+ * Allocates and initialises an empty ring.
+ *
+ * The low watermark is half the capacity and the high watermark is the
+ * capacity, see isaac_ring_watermarks().
+ *
+ * @param[in] batches capacity of the ring in batches of #ISAAC_ELEMENTS
+ * integers, rounded up to a power of 2. Returns NULL when 0.
+ * @param[in] seed pointer to the seed to use, as in isaac_init().
+ * @param[in] seed_bytes amount of **bytes** in the seed, as in isaac_init().
+ * @return the ring, or NULL when out of memory or resources.
+ */
+isaac_ring_t* isaac_ring_new(size_t batches,
+                             const uint8_t* seed,
+                             uint16_t seed_bytes);
+
+/**
+ * Stops the producer thread, if started with isaac_ring_start(), safely
+ * erases the ring and frees it.
+ *
+ * No other thread may use the ring during and after the call.
+ *
+ * @param[in, out] ring the ring. Does nothing when NULL.
+ */
+void isaac_ring_free(isaac_ring_t* ring);
+
+/**
+ * Sets the levels, in integers, at which the producer sleeps and wakes up.
+ *
+ * @param[in, out] ring the ring. Does nothing when NULL.
+ * @param[in] low the producer is woken up when the ring holds this many
+ * integers or fewer. Lowered to \p high - 1 if greater.
+ * @param[in] high isaac_ring_fill() generates batches while the ring holds
+ * at most this many integers after them. Clamped between #ISAAC_ELEMENTS and
+ * the capacity.
+ */
+void isaac_ring_watermarks(isaac_ring_t* ring, size_t low, size_t high);
+
+/**
+ * Provides the amount of integers in the ring, ready to be read.
+ *
+ * With concurrent producer or consumers it may be outdated as soon as
+ * returned.
+ *
+ * @param[in] ring the ring. Returns 0 when NULL.
+ * @return the amount of integers ready to be read.
+ */
+size_t isaac_ring_available(isaac_ring_t* ring);
+
+/**
+ * Generates batches into the ring up to the high watermark, without
+ * blocking.
+ *
+ * To be called by the single producer thread only.
+ *
+ * @param[in, out] ring the ring. Does nothing when NULL.
+ * @return the amount of batches generated, 0 when the ring was full.
+ */
+size_t isaac_ring_fill(isaac_ring_t* ring);
+
+/**
+ * Sleeps until the ring is drained to the low watermark or freed.
+ *
+ * To be called by the single producer thread only, usually in a loop with
+ * isaac_ring_fill(). Returns immediately when the library is built without
+ * threads support.
+ *
+ * @param[in, out] ring the ring. Does nothing when NULL.
+ */
+void isaac_ring_wait(isaac_ring_t* ring);
+
+/**
+ * Starts a producer thread of the library, filling the ring and sleeping in
+ * turn until isaac_ring_free().
+ *
+ * No other thread may call isaac_ring_fill() or isaac_ring_wait() then.
+ *
+ * @param[in, out] ring the ring. Returns false when NULL.
+ * @return true when the producer thread is running, also if it already was;
+ * false when it could not be started or the library was built without
+ * threads support.
+ */
+bool isaac_ring_start(isaac_ring_t* ring);
+
+/**
+ * Takes pseudo-random integers from the ring, without blocking.
+ *
+ * Safe to call from any amount of threads concurrently. Wakes up the
+ * producer when the ring is drained to the low watermark.
+ *
+ * @param[in, out] ring the ring. Returns 0 when NULL.
+ * @param[out] ints pseudo-random integers. Returns 0 when NULL.
+ * @param[in] amount maximum quantity of integers to take.
+ * @return the quantity of integers taken: fewer than \p amount when the
+ * ring runs empty.
+ */
+size_t isaac_ring_read(isaac_ring_t* ring, isaac_uint_t* ints, size_t amount);
+
+/**
+ * Takes pseudo-random bytes from the ring, without blocking.
+ *
+ * Same as isaac_ring_read(), with the integers converted to bytes in little
+ * endian byte order. The unused bytes of the last integer are discarded.
+ *
+ * @param[in, out] ring the ring. Returns 0 when NULL.
+ * @param[out] bytes pseudo-random bytes. Returns 0 when NULL.
+ * @param[in] amount maximum quantity of bytes to take.
+ * @return the quantity of bytes taken: fewer than \p amount when the ring
+ * runs empty.
+ */
+size_t isaac_ring_read_bytes(isaac_ring_t* ring, uint8_t* bytes, size_t amount);
+
+/**
+ * Pool of ISAAC contexts, carved out of slabs of #ISAAC_POOL_SLAB_BYTES
+ * bytes, for programs creating and destroying very many of them.
+ *
+ * The slabs are mapped aligned to their size and marked for transparent huge
+ * pages where available, so a slab of contexts costs a single TLB entry and
+ * few page faults instead of one per page. Contexts are aligned to the cache
+ * line. Acquiring and releasing a context take constant time: the released
+ * contexts are kept in a free list and reused first, new slabs are mapped
+ * only when all the others are in use.
+ *
+ * With #ISAAC_POOL_LOCKED and #ISAAC_POOL_NO_DUMP, the secret state of the
+ * contexts never reaches the swap or the core dumps.
+ *
+ * Not thread-safe: each thread should use its own pool, or a lock.
+ *
+ * Opaque: created with isaac_pool_new(), destroyed with isaac_pool_free().
+ */
+typedef struct isaac_pool_s isaac_pool_t;
+
+/**
+ * Allocates a pool of contexts and maps its first slab.
+ *
+ * @param[in] flags #isaac_pool_flags_t combined with bitwise or, applied to
+ * every slab.
+ * @return the pool, or NULL when out of memory, when the first slab could not
+ * be locked or excluded from the core dumps as requested (e.g. the limit of
+ * locked memory is too low) or when the platform does not support the flags.
+ */
+isaac_pool_t* isaac_pool_new(unsigned int flags);
+
+/**
+ * Takes a context from the pool and initialises it with a seed, as
+ * isaac_init() does.
+ *
+ * @param[in, out] pool the pool. Returns NULL when NULL.
+ * @param[in] seed pointer to the seed to use, as in isaac_init().
+ * @param[in] seed_bytes amount of **bytes** in the seed, as in isaac_init().
+ * @return the context, aligned to #ISAAC_CACHE_LINE bytes, valid until
+ * released to the same pool; NULL when a new slab was needed and could not
+ * be mapped, locked or excluded from the core dumps.
+ */
+isaac_ctx_t* isaac_pool_acquire(isaac_pool_t* pool,
+                                const uint8_t* seed,
+                                uint16_t seed_bytes);
+
+/**
+ * Safely erases a context, as isaac_cleanup() does, and gives it back to the
+ * pool it was acquired from.
+ *
+ * @param[in, out] pool the pool. Does nothing when NULL.
+ * @param[in, out] ctx the context, acquired from \p pool and not released
+ * yet. Does nothing when NULL.
+ */
+void isaac_pool_release(isaac_pool_t* pool, isaac_ctx_t* ctx);
+
+/**
+ * Provides the amount of contexts acquired and not released yet.
+ *
+ * @param[in] pool the pool. Returns 0 when NULL.
+ * @return the amount of contexts in use.
+ */
+size_t isaac_pool_in_use(const isaac_pool_t* pool);
+
+/**
+ * Safely erases all contexts of the pool in bulk, slab by slab, and gives
+ * them all back to the pool, keeping the slabs for reuse.
+ *
+ * All contexts acquired before are invalid afterwards.
+ *
+ * @param[in, out] pool the pool. Does nothing when NULL.
+ */
+void isaac_pool_reset(isaac_pool_t* pool);
+
+/**
+ * Safely erases all contexts of the pool, unmaps its slabs and frees it.
+ *
+ * @param[in, out] pool the pool. Does nothing when NULL.
+ */
+void isaac_pool_free(isaac_pool_t* pool);
+
+/**
+ * Context of an ISAAC CPRNG without the buffer of the current batch: about
+ * half the size of #isaac_ctx_t, for programs keeping very many generators.
+ *
+ * Generates exactly the same stream as #isaac_ctx_t with the same seed. The
+ * integers are not generated a batch at the time into the context, but one at
+ * the time when requested, straight into the output; whole batches still
+ * run at the speed of isaac_stream().
+ *
+ * Initialise it with isaac_lean_init() and read it with isaac_lean_stream().
+ */
+typedef struct
+{
+    /** Internal field. */
+    isaac_uint_t mem[ISAAC_ELEMENTS];
+    /** Internal field. */
+    isaac_uint_t a;
+    /** Internal field. */
+    isaac_uint_t b;
+    /** Internal field. */
+    isaac_uint_t c;
+    /**
+     * Amount of integers of the current batch already output, 0 when the
+     * next one starts a new batch.
+     */
+    isaac_uint_t index;
+} isaac_lean_ctx_t;
+
+/**
+ * Initialises a lean ISAAC CPRNG with a seed.
+ *
+ * Same as isaac_init(), but without generating the first batch, which is
+ * generated while being output instead.
+ *
+ * @param[in, out] ctx the ISAAC state to be initialised. Does nothing when
+ * NULL.
+ * @param[in] seed pointer to the seed to use, as in isaac_init().
+ * @param[in] seed_bytes amount of **bytes** in the seed, as in isaac_init().
+ */
+void isaac_lean_init(isaac_lean_ctx_t* ctx,
+                     const uint8_t* seed,
+                     uint16_t seed_bytes);
+
+/**
+ * Provides the next pseudo-random integers of a lean ISAAC CPRNG.
+ *
+ * Same as isaac_stream() and with the same output for the same seed.
+ *
+ * @param[in, out] ctx the ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[out] ints pseudo-random integers. Must be at least \p amount
+ * integers long. Does nothing when NULL.
+ * @param[in] amount quantity of 32-bit/64-bit integers to generate.
+ */
+void isaac_lean_stream(isaac_lean_ctx_t* ctx,
+                       isaac_uint_t* ints,
+                       size_t amount);
+
+/**
+ * Safely erases the context of a lean ISAAC CPRNG, as isaac_cleanup() does.
+ *
+ * @param[in, out] ctx the ISAAC state to cleanup. Does nothing when NULL.
+ */
+void isaac_lean_cleanup(isaac_lean_ctx_t* ctx);
+
+/**
+ * Context of #ISAAC_X4_LANES independent ISAAC CPRNGs, advanced together.
+ *
+ * Each lane is a complete ISAAC state with its own seed. The states are
+ * stored interleaved, so that the value `i` of lane `l` is at index
+ * `i * ISAAC_X4_LANES + l`, allowing the reshuffling to process all lanes
+ * with the same vector instruction. The output of each lane is exactly the
+ * output of a #isaac_ctx_t initialised with the same seed.
+ *
+ * No need to inspect it manually, use the functions instead.
+ */
+typedef struct
+{
+    /** Interleaved pseudo-random data of all lanes. */
+    isaac_uint_t result[ISAAC_ELEMENTS * ISAAC_X4_LANES];
+    /** Internal field. */
+    isaac_uint_t mem[ISAAC_ELEMENTS * ISAAC_X4_LANES];
+    /** Internal field. */
+    isaac_uint_t a[ISAAC_X4_LANES];
+    /** Internal field. */
+    isaac_uint_t b[ISAAC_X4_LANES];
+    /** Internal field. */
+    isaac_uint_t c[ISAAC_X4_LANES];
+    /** Index of the next value to output in the stream, equal for all lanes. */
+    isaac_uint_t stream_index;
+} isaac_x4_ctx_t;
+
+/**
+ * Context of #ISAAC_X8_LANES independent ISAAC CPRNGs, advanced together.
+ *
+ * Same as #isaac_x4_ctx_t, but with #ISAAC_X8_LANES lanes instead, which
+ * better fits wider vector units.
+ *
+ * No need to inspect it manually, use the functions instead.
+ */
+typedef struct
+{
+    /** Interleaved pseudo-random data of all lanes. */
+    isaac_uint_t result[ISAAC_ELEMENTS * ISAAC_X8_LANES];
+    /** Internal field. */
+    isaac_uint_t mem[ISAAC_ELEMENTS * ISAAC_X8_LANES];
+    /** Internal field. */
+    isaac_uint_t a[ISAAC_X8_LANES];
+    /** Internal field. */
+    isaac_uint_t b[ISAAC_X8_LANES];
+    /** Internal field. */
+    isaac_uint_t c[ISAAC_X8_LANES];
+    /** Index of the next value to output in the stream, equal for all lanes. */
+    isaac_uint_t stream_index;
+} isaac_x8_ctx_t;
+
+/**
+ * Initialises #ISAAC_X4_LANES ISAAC CPRNGs, each with its own seed.
+ *
+ * Lane `l` is initialised exactly as isaac_init() would do with
+ * `seeds[l]` and `seed_bytes[l]`, including the same handling of NULL and
+ * too long seeds.
+ *
+ * @param[in, out] ctx the multi-lane ISAAC state to be initialised. Does
+ * nothing when NULL.
+ * @param[in] seeds one seed per lane. Each may be NULL to use a zero seed
+ * (**insecure!**). If NULL, all lanes use a zero seed (**insecure!**).
+ * @param[in] seed_bytes amount of **bytes** in each seed, max
+ * #ISAAC_SEED_MAX_BYTES. If NULL, all lanes use a zero seed (**insecure!**).
+ */
+void isaac_x4_init(isaac_x4_ctx_t* ctx,
+                   const uint8_t* const seeds[ISAAC_X4_LANES],
+                   const uint16_t seed_bytes[ISAAC_X4_LANES]);
+
+/**
+ * Provides the next pseudo-random integers of every lane.
+ *
+ * Lane `l` writes \p amount integers into `ints[l]`, the same integers
+ * isaac_stream() would provide for a #isaac_ctx_t with the same seed.
+ * All lanes are reshuffled together with vector instructions, when available.
+ *
+ * @param[in, out] ctx the multi-lane ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[out] ints one output buffer per lane, each at least \p amount
+ * integers long. Does nothing when NULL. A NULL buffer skips the output
+ * of its lane, whose values are discarded.
+ * @param[in] amount quantity of 32-bit/64-bit integers to generate per lane.
+ */
+void isaac_x4_stream(isaac_x4_ctx_t* ctx,
+                     isaac_uint_t* const ints[ISAAC_X4_LANES],
+                     size_t amount);
+
+/**
+ * Safely erases the multi-lane context.
+ *
+ * @param[in, out] ctx the multi-lane ISAAC state to cleanup. Does nothing when
+ * NULL.
+ */
+void isaac_x4_cleanup(isaac_x4_ctx_t* ctx);
+
+/**
+ * Initialises #ISAAC_X8_LANES ISAAC CPRNGs, each with its own seed.
+ *
+ * Same as isaac_x4_init(), but for #ISAAC_X8_LANES lanes.
+ *
+ * @param[in, out] ctx the multi-lane ISAAC state to be initialised. Does
+ * nothing when NULL.
+ * @param[in] seeds one seed per lane. Each may be NULL to use a zero seed
+ * (**insecure!**). If NULL, all lanes use a zero seed (**insecure!**).
+ * @param[in] seed_bytes amount of **bytes** in each seed, max
+ * #ISAAC_SEED_MAX_BYTES. If NULL, all lanes use a zero seed (**insecure!**).
+ */
+void isaac_x8_init(isaac_x8_ctx_t* ctx,
+                   const uint8_t* const seeds[ISAAC_X8_LANES],
+                   const uint16_t seed_bytes[ISAAC_X8_LANES]);
+
+/**
+ * Provides the next pseudo-random integers of every lane.
+ *
+ * Same as isaac_x4_stream(), but for #ISAAC_X8_LANES lanes.
+ *
+ * @param[in, out] ctx the multi-lane ISAAC state, already initialised.
+ * Does nothing when NULL.
+ * @param[out] ints one output buffer per lane, each at least \p amount
+ * integers long. Does nothing when NULL. A NULL buffer skips the output
+ * of its lane, whose values are discarded.
+ * @param[in] amount quantity of 32-bit/64-bit integers to generate per lane.
+ */
+void isaac_x8_stream(isaac_x8_ctx_t* ctx,
+                     isaac_uint_t* const ints[ISAAC_X8_LANES],
+                     size_t amount);
+
+/**
+ * Safely erases the multi-lane context.
+ *
+ * @param[in, out] ctx the multi-lane ISAAC state to cleanup. Does nothing when
+ * NULL.
+ */
+void isaac_x8_cleanup(isaac_x8_ctx_t* ctx);
@@ -13,73 +13,257 @@
  */
 
 #include "isaac.h"
+#include "isaac_alloc.h"
+#include "isaac_kernel.h"
+#include "isaac_mix.h"
+#include <string.h>
 
 #if ISAAC_BITS > 32
 #define ISAAC_IND(mm, x)  (*(uint64_t*)((uint8_t*)(mm) \
                           + ((x) & ((ISAAC_ELEMENTS - 1) << 3))))
 
-#define ISAAC_STEP(mix, a, b, mm, m, m2, r, x) \
+#define ISAAC_STEP(mix, a, b, mm, m, m2, r, x, store) \
 { \
   x = *m;  \
   a = (mix) + *(m2++); \
   *(m++) = y = ISAAC_IND(mm, x) + a + b; \
-  *(r++) = b = ISAAC_IND(mm, y >> 8U) + x; \
+  b = ISAAC_IND(mm, y >> 8U) + x; \
+  store(r, b); \
 }
 
-#define ISAAC_MIX(a, b, c, d, e, f, g, h) \
+#define ISAAC_ROUND(a, b, mm, m, m2, r, x, store) \
 { \
-   a -= e; f ^= h >> 9U;  h += a; \
-   b -= f; g ^= a << 9U;  a += b; \
-   c -= g; h ^= b >> 23U; b += c; \
-   d -= h; a ^= c << 15U; c += d; \
-   e -= a; b ^= d >> 14U; d += e; \
-   f -= b; c ^= e << 20U; e += f; \
-   g -= c; d ^= f >> 17U; f += g; \
-   h -= d; e ^= g << 14U; g += h; \
-}
-
-/* Explanations why it does not look like 1.618033988749894848...:
- * https://stackoverflow.com/a/4948967
- * https://softwareengineering.stackexchange.com/a/63605
- */
-#define GOLDEN_RATIO 0x9e3779b97f4a7c13LL
+  ISAAC_STEP(~(a ^ (a << 21U)), a, b, mm, m, m2, r, x, store); \
+  ISAAC_STEP(a ^ (a >> 5U), a, b, mm, m, m2, r, x, store); \
+  ISAAC_STEP(a ^ (a << 12U), a, b, mm, m, m2, r, x, store); \
+  ISAAC_STEP(a ^ (a >> 33U), a, b, mm, m, m2, r, x, store); \
+}
 #else
 #define ISAAC_IND(mm, x) ((mm)[(x >> 2U) & (ISAAC_ELEMENTS - 1)])
 
-#define ISAAC_STEP(mix, a, b, mm, m, m2, r, x) \
+#define ISAAC_STEP(mix, a, b, mm, m, m2, r, x, store) \
 { \
   x = *m;  \
   a = (a^(mix)) + *(m2++); \
   *(m++) = y = ISAAC_IND(mm, x) + a + b; \
-  *(r++) = b = ISAAC_IND(mm, y >> 8U) + x; \
+  b = ISAAC_IND(mm, y >> 8U) + x; \
+  store(r, b); \
 }
 
-#define ISAAC_MIX(a, b, c, d, e, f, g, h) \
+#define ISAAC_ROUND(a, b, mm, m, m2, r, x, store) \
 { \
-   a ^= b << 11U; d += a; b += c; \
-   b ^= c >> 2U;  e += b; c += d; \
-   c ^= d << 8U;  f += c; d += e; \
-   d ^= e >> 16U; g += d; e += f; \
-   e ^= f << 10U; h += e; f += g; \
-   f ^= g >> 4U;  a += f; g += h; \
-   g ^= h << 8U;  b += g; h += a; \
-   h ^= a >> 9U;  c += h; a += b; \
-}
-
-/* Explanations why it does not look like 1.618033988749894848...:
- * https://stackoverflow.com/a/4948967
- * https://softwareengineering.stackexchange.com/a/63605
+  ISAAC_STEP(a << 13U, a, b, mm, m, m2, r, x, store); \
+  ISAAC_STEP(a >> 6U, a, b, mm, m, m2, r, x, store); \
+  ISAAC_STEP(a << 2U, a, b, mm, m, m2, r, x, store); \
+  ISAAC_STEP(a >> 16U, a, b, mm, m, m2, r, x, store); \
+}
+#endif
+
+/* Permutes the ISAAC state in ctx, passing each new output value to the
+ * store macro together with the output cursor r. */
+#define ISAAC_SHUFFLE(ctx, r, store) \
+{ \
+    isaac_uint_t* m; \
+    isaac_uint_t* const mm = (ctx)->mem; \
+    isaac_uint_t* m2; \
+    isaac_uint_t* mend; \
+    isaac_uint_t a = (ctx)->a; \
+    isaac_uint_t b = (ctx)->b + (++(ctx)->c); \
+    isaac_uint_t x; \
+    isaac_uint_t y; \
+    for (m = mm, mend = m2 = m + (ISAAC_ELEMENTS / 2U); m < mend;) \
+    { \
+        ISAAC_ROUND(a, b, mm, m, m2, r, x, store); \
+    } \
+    for (m2 = mm; m2 < mend;) \
+    { \
+        ISAAC_ROUND(a, b, mm, m, m2, r, x, store); \
+    } \
+    (ctx)->b = b; \
+    (ctx)->a = a; \
+}
+
+#define ISAAC_STORE(r, value) (*(r)++ = (value))
+
+/* Discards the new value: only the permuted state is of interest. */
+#define ISAAC_STORE_NONE(r, value) ((void) (r), (void) (value))
+
+#if ISAAC_KERNEL_X86 && defined(__x86_64__)
+/* SSE2 is part of the x86-64 baseline: no need to check for it. */
+#define ISAAC_NONTEMPORAL 1
+#if ISAAC_BITS > 32
+#define ISAAC_STORE_NT(r, value) \
+    _mm_stream_si64((long long*) (r)++, (long long) (value))
+#else
+#define ISAAC_STORE_NT(r, value) \
+    _mm_stream_si32((int*) (r)++, (int) (value))
+#endif
+#else
+#define ISAAC_NONTEMPORAL 0
+#endif
+
+/* Byte order of the host, when known at compile time. */
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) \
+    && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define ISAAC_HOST_LITTLE_ENDIAN 1
+#define ISAAC_HOST_BIG_ENDIAN 0
+#elif defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) \
+    && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define ISAAC_HOST_LITTLE_ENDIAN 0
+#define ISAAC_HOST_BIG_ENDIAN 1
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86) \
+                            || defined(_M_ARM) || defined(_M_ARM64))
+#define ISAAC_HOST_LITTLE_ENDIAN 1
+#define ISAAC_HOST_BIG_ENDIAN 0
+#else
+#define ISAAC_HOST_LITTLE_ENDIAN 0
+#define ISAAC_HOST_BIG_ENDIAN 0
+#endif
+
+#if ISAAC_HOST_LITTLE_ENDIAN || ISAAC_HOST_BIG_ENDIAN
+/**
+ * @internal
+ * Reverses the order of the bytes of a value.
+ */
+static inline isaac_uint_t reverse_value(const isaac_uint_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+#if ISAAC_BITS > 32
+    return __builtin_bswap64(value);
+#else
+    return __builtin_bswap32(value);
+#endif
+#else
+    isaac_uint_t reversed = 0;
+    for (uint_fast8_t i = 0; i < sizeof(isaac_uint_t); i++)
+    {
+        reversed = (reversed << 8U) | ((value >> (8U * i)) & 0xFFU);
+    }
+    return reversed;
+#endif
+}
+#endif
+
+/**
+ * @internal
+ * Writes a value as little endian bytes.
+ *
+ * @return the position after the written bytes.
+ */
+static inline uint8_t* store_little_endian(uint8_t* const bytes,
+                                           isaac_uint_t value)
+{
+#if ISAAC_HOST_LITTLE_ENDIAN || ISAAC_HOST_BIG_ENDIAN
+#if ISAAC_HOST_BIG_ENDIAN
+    value = reverse_value(value);
+#endif
+    memcpy(bytes, &value, sizeof(value));
+#else
+    for (uint_fast8_t i = 0; i < sizeof(isaac_uint_t); i++)
+    {
+        bytes[i] = (uint8_t) (value >> (8U * i));
+    }
+#endif
+    return bytes + sizeof(value);
+}
+
+/**
+ * @internal
+ * Writes a value as big endian bytes.
+ *
+ * @return the position after the written bytes.
  */
-#define GOLDEN_RATIO 0x9e3779b9L
+static inline uint8_t* store_big_endian(uint8_t* const bytes,
+                                        isaac_uint_t value)
+{
+#if ISAAC_HOST_LITTLE_ENDIAN || ISAAC_HOST_BIG_ENDIAN
+#if ISAAC_HOST_LITTLE_ENDIAN
+    value = reverse_value(value);
+#endif
+    memcpy(bytes, &value, sizeof(value));
+#else
+    for (uint_fast8_t i = 0; i < sizeof(isaac_uint_t); i++)
+    {
+        bytes[sizeof(isaac_uint_t) - 1U - i] = (uint8_t) (value >> (8U * i));
+    }
 #endif
+    return bytes + sizeof(value);
+}
+
+/* Stores for ISAAC_SHUFFLE() serialising each value into the byte cursor r. */
+#define ISAAC_STORE_LE(r, value) ((r) = store_little_endian((r), (value)))
+#define ISAAC_STORE_BE(r, value) ((r) = store_big_endian((r), (value)))
 
 
 static void isaac_shuffle(isaac_ctx_t* ctx);
 
-static void set_seed(isaac_ctx_t* ctx,
+static void set_seed(isaac_uint_t* values,
                      const uint8_t* seed,
                      uint16_t seed_bytes);
 
+/**
+ * @internal
+ * Initialises the internal state from the seed, as copied by set_seed(), with
+ * the two mixing passes of the original implementation.
+ *
+ * @param mem the internal state to initialise
+ * @param seed_values the seed, #ISAAC_ELEMENTS values
+ */
+static void init_state(isaac_uint_t* const mem,
+                       const isaac_uint_t* const seed_values)
+{
+    isaac_uint_t a, b, c, d, e, f, g, h;
+    uint_fast16_t i; /* Fastest index over elements in result[] and mem[]. */
+    a = b = c = d = e = f = g = h = GOLDEN_RATIO;
+    /* Scramble it */
+    for (i = 0; i < 4; i++)
+    {
+        ISAAC_MIX(a, b, c, d, e, f, g, h);
+    }
+    /* Initialise using the contents of the seed. */
+    for (i = 0; i < ISAAC_ELEMENTS; i += 8)
+    {
+        a += seed_values[i + 0];
+        b += seed_values[i + 1];
+        c += seed_values[i + 2];
+        d += seed_values[i + 3];
+        e += seed_values[i + 4];
+        f += seed_values[i + 5];
+        g += seed_values[i + 6];
+        h += seed_values[i + 7];
+        ISAAC_MIX(a, b, c, d, e, f, g, h);
+        mem[i + 0] = a;
+        mem[i + 1] = b;
+        mem[i + 2] = c;
+        mem[i + 3] = d;
+        mem[i + 4] = e;
+        mem[i + 5] = f;
+        mem[i + 6] = g;
+        mem[i + 7] = h;
+    }
+    /* Do a second pass to make all of the seed affect all of mem. */
+    for (i = 0; i < ISAAC_ELEMENTS; i += 8)
+    {
+        a += mem[i + 0];
+        b += mem[i + 1];
+        c += mem[i + 2];
+        d += mem[i + 3];
+        e += mem[i + 4];
+        f += mem[i + 5];
+        g += mem[i + 6];
+        h += mem[i + 7];
+        ISAAC_MIX(a, b, c, d, e, f, g, h);
+        mem[i + 0] = a;
+        mem[i + 1] = b;
+        mem[i + 2] = c;
+        mem[i + 3] = d;
+        mem[i + 4] = e;
+        mem[i + 5] = f;
+        mem[i + 6] = g;
+        mem[i + 7] = h;
+    }
+}
+
 void isaac_init(isaac_ctx_t* const ctx,
                 const uint8_t* const seed,
                 const uint16_t seed_bytes)
@@ -88,38 +272,144 @@ void isaac_init(isaac_ctx_t* const ctx,
     {
         return;
     }
-    isaac_uint_t a, b, c, d, e, f, g, h;
-    uint_fast16_t i; /* Fastest index over elements in result[] and mem[]. */
     ctx->stream_index = ctx->a = ctx->b = ctx->c = 0;
-    a = b = c = d = e = f = g = h = GOLDEN_RATIO;
-    /* Scramble it */
-    for (i = 0; i < 4; i++)
+    ctx->stream_byte = ctx->stream_byte_order = 0;
+#if ISAAC_CTX_ALIGNED
+    memset(ctx->padding, 0, sizeof(ctx->padding));
+#endif
+    /* The seed goes into result[], overwritten by the first batch. */
+    set_seed(ctx->result, seed, seed_bytes);
+    init_state(ctx->mem, ctx->result);
+    /* Fill in the first set of results. */
+    isaac_shuffle(ctx);
+}
+
+isaac_ctx_t* isaac_ctx_new(const uint8_t* const seed,
+                           const uint16_t seed_bytes)
+{
+    isaac_ctx_t* const ctx = alloc_aligned(ISAAC_CACHE_LINE,
+                                           sizeof(isaac_ctx_t));
+    isaac_init(ctx, seed, seed_bytes);
+    return ctx;
+}
+
+void isaac_ctx_free(isaac_ctx_t* const ctx)
+{
+    isaac_cleanup(ctx);
+    alloc_aligned_free(ctx);
+}
+
+void isaac_split(isaac_ctx_t* const parent,
+                 isaac_ctx_t* const child,
+                 const uint64_t label)
+{
+    if (parent == NULL || child == NULL || parent == child)
     {
-        ISAAC_MIX(a, b, c, d, e, f, g, h);
+        return;
     }
-    set_seed(ctx, seed, seed_bytes);
-    /* Initialise using the contents of result[] as the seed. */
+    isaac_uint_t fresh[8];
+    isaac_uint_t a, b, c, d, e, f, g, h;
+    uint_fast16_t i;
+    /* Fresh values of the parent, so no two splits give the same child. */
+    isaac_stream(parent, fresh, 8);
+#if ISAAC_BITS > 32
+    a = fresh[0] ^ label;
+    b = fresh[1];
+#else
+    a = fresh[0] ^ (isaac_uint_t) label;
+    b = fresh[1] ^ (isaac_uint_t) (label >> 32U);
+#endif
+    c = fresh[2];
+    d = fresh[3];
+    e = fresh[4];
+    f = fresh[5];
+    g = fresh[6];
+    h = fresh[7];
+    ISAAC_MIX(a, b, c, d, e, f, g, h);
+    /* A single pass over the parent's state: the key is already random and
+     * chained through all of it. */
     for (i = 0; i < ISAAC_ELEMENTS; i += 8)
     {
-        a += ctx->result[i + 0];
-        b += ctx->result[i + 1];
-        c += ctx->result[i + 2];
-        d += ctx->result[i + 3];
-        e += ctx->result[i + 4];
-        f += ctx->result[i + 5];
-        g += ctx->result[i + 6];
-        h += ctx->result[i + 7];
+        a += parent->mem[i + 0];
+        b += parent->mem[i + 1];
+        c += parent->mem[i + 2];
+        d += parent->mem[i + 3];
+        e += parent->mem[i + 4];
+        f += parent->mem[i + 5];
+        g += parent->mem[i + 6];
+        h += parent->mem[i + 7];
+        ISAAC_MIX(a, b, c, d, e, f, g, h);
+        child->mem[i + 0] = a;
+        child->mem[i + 1] = b;
+        child->mem[i + 2] = c;
+        child->mem[i + 3] = d;
+        child->mem[i + 4] = e;
+        child->mem[i + 5] = f;
+        child->mem[i + 6] = g;
+        child->mem[i + 7] = h;
+    }
+    child->stream_index = child->a = child->b = child->c = 0;
+    child->stream_byte = child->stream_byte_order = 0;
+#if ISAAC_CTX_ALIGNED
+    memset(child->padding, 0, sizeof(child->padding));
+#endif
+    isaac_shuffle(child);
+    memset(fresh, 0, sizeof(fresh));
+}
+
+/**
+ * @internal
+ * Reads up to sizeof(isaac_uint_t) bytes as a little endian integer, whatever
+ * the host byte order.
+ */
+static isaac_uint_t load_little_endian(const uint8_t* const bytes,
+                                       const size_t amount)
+{
+    isaac_uint_t value = 0;
+    for (size_t i = 0; i < amount; i++)
+    {
+        value |= (isaac_uint_t) ((isaac_uint_t) bytes[i] << (8U * i));
+    }
+    return value;
+}
+
+void isaac_reseed(isaac_ctx_t* const ctx,
+                  const uint8_t* entropy,
+                  size_t entropy_bytes)
+{
+    if (ctx == NULL || entropy == NULL || entropy_bytes == 0)
+    {
+        return;
+    }
+    isaac_uint_t a, b, c, d, e, f, g, h;
+    isaac_uint_t words[8];
+    uint_fast16_t i;
+    a = ctx->a;
+    b = ctx->b;
+    c = ctx->c;
+    d = e = f = g = h = GOLDEN_RATIO;
+    /* Absorb all the entropy first, so all of it affects all of ctx->mem[]
+     * with a single pass. */
+    while (entropy_bytes)
+    {
+        for (i = 0; i < 8; i++)
+        {
+            const size_t amount = (entropy_bytes < sizeof(isaac_uint_t))
+                                  ? entropy_bytes : sizeof(isaac_uint_t);
+            words[i] = load_little_endian(entropy, amount);
+            entropy += amount;
+            entropy_bytes -= amount;
+        }
+        a += words[0];
+        b += words[1];
+        c += words[2];
+        d += words[3];
+        e += words[4];
+        f += words[5];
+        g += words[6];
+        h += words[7];
         ISAAC_MIX(a, b, c, d, e, f, g, h);
-        ctx->mem[i + 0] = a;
-        ctx->mem[i + 1] = b;
-        ctx->mem[i + 2] = c;
-        ctx->mem[i + 3] = d;
-        ctx->mem[i + 4] = e;
-        ctx->mem[i + 5] = f;
-        ctx->mem[i + 6] = g;
-        ctx->mem[i + 7] = h;
     }
-    /* Do a second pass to make all of the seed affect all of ctx->mem. */
     for (i = 0; i < ISAAC_ELEMENTS; i += 8)
     {
         a += ctx->mem[i + 0];
@@ -140,21 +430,30 @@ void isaac_init(isaac_ctx_t* const ctx,
         ctx->mem[i + 6] = g;
         ctx->mem[i + 7] = h;
     }
-    /* Fill in the first set of results. */
-    isaac_shuffle(ctx);
-    /* Prepare to use the first set of results with next32() and next8(). */
+    ctx->a = a;
+    ctx->b = b;
+    ctx->c = c;
+    memset(words, 0, sizeof(words));
+}
 
+void isaac_clone(isaac_ctx_t* const dst, const isaac_ctx_t* const src)
+{
+    if (dst == NULL || src == NULL || dst == src)
+    {
+        return;
+    }
+    *dst = *src;
 }
 
 /**
  * @internal
- * Copies the seed into ctx->result[], padding it with zeros.
+ * Copies the seed into #ISAAC_ELEMENTS values, padding it with zeros.
  *
- * @param ctx the ISAAC state
+ * @param values destination of the seed, #ISAAC_ELEMENTS values
  * @param seed bytes of the seed. If NULL, a zero-seed is used.
  * @param seed_bytes amount of bytes in the seed.
  */
-static void set_seed(isaac_ctx_t* const ctx,
+static void set_seed(isaac_uint_t* const values,
                      const uint8_t* const seed,
                      uint16_t seed_bytes)
 {
@@ -170,7 +469,7 @@ static void set_seed(isaac_ctx_t* const ctx,
             /* The copy is performed VALUE-wise, not byte wise.
              * By doing so we have same result[] on architectures with different
              * endianness. */
-            ctx->result[i] = seed[i];
+            values[i] = seed[i];
         }
     }
     else
@@ -179,88 +478,500 @@ static void set_seed(isaac_ctx_t* const ctx,
     }
     for (i = seed_bytes; i < ISAAC_SEED_MAX_BYTES; i++)
     {
-        ctx->result[i] = 0;
+        values[i] = 0;
     }
 }
 
 /**
  * @internal
- * Permutes the ISAAC state.
+ * Permutes the ISAAC state, writing the next batch of #ISAAC_ELEMENTS values
+ * into r.
+ *
+ * Maps to `void isaac(randctx*)` from the original implementation, where
+ * r is always ctx->result.
  *
- * Maps to `void isaac(randctx*)` from the original implementation.
+ * @param ctx the ISAAC state
+ * @param r destination of the new values, either ctx->result or any other
+ * buffer of #ISAAC_ELEMENTS values.
+ */
+static void isaac_shuffle_to(isaac_ctx_t* const ctx, isaac_uint_t* r)
+{
+    ISAAC_SHUFFLE(ctx, r, ISAAC_STORE);
+}
+
+/**
+ * @internal
+ * Permutes the ISAAC state, preparing the next batch in ctx->result.
  *
  * @param ctx the ISAAC state
  */
 static void isaac_shuffle(isaac_ctx_t* const ctx)
 {
-    isaac_uint_t* m;
-    isaac_uint_t* mm = ctx->mem;
-    isaac_uint_t* m2;
-    isaac_uint_t* r = ctx->result;
-    isaac_uint_t* mend;
-    isaac_uint_t a = ctx->a;
-    isaac_uint_t b = ctx->b + (++ctx->c);
-    isaac_uint_t x;
-    isaac_uint_t y;
-#if ISAAC_BITS > 32
-    for (m = mm, mend = m2 = m + (ISAAC_ELEMENTS / 2U); m < mend;)
+    isaac_shuffle_to(ctx, ctx->result);
+}
+
+#if ISAAC_NONTEMPORAL
+/**
+ * @internal
+ * Same as isaac_shuffle_to(), but writing r with non-temporal stores, which
+ * bypass the cache. The caller must issue a store fence afterwards.
+ */
+static void isaac_shuffle_to_nt(isaac_ctx_t* const ctx, isaac_uint_t* r)
+{
+    ISAAC_SHUFFLE(ctx, r, ISAAC_STORE_NT);
+}
+#endif
+
+/**
+ * @internal
+ * Same as isaac_shuffle_to(), but writing the new values as little endian
+ * bytes, #ISAAC_ELEMENTS * sizeof(isaac_uint_t) of them.
+ */
+static void isaac_shuffle_to_little_endian(isaac_ctx_t* const ctx, uint8_t* r)
+{
+    ISAAC_SHUFFLE(ctx, r, ISAAC_STORE_LE);
+}
+
+/**
+ * @internal
+ * Same as isaac_shuffle_to_little_endian(), in big endian byte order.
+ */
+static void isaac_shuffle_to_big_endian(isaac_ctx_t* const ctx, uint8_t* r)
+{
+    ISAAC_SHUFFLE(ctx, r, ISAAC_STORE_BE);
+}
+
+/**
+ * @internal
+ * Same as isaac_shuffle(), but discarding the new values: the state advances
+ * by a batch without writing any output.
+ */
+static void isaac_shuffle_discard(isaac_ctx_t* const ctx)
+{
+    const isaac_uint_t* const r = NULL;
+    ISAAC_SHUFFLE(ctx, r, ISAAC_STORE_NONE);
+}
+
+#define ISAAC_MIN(a, b) ((a) < (b)) ? (a) : (b)
+
+/**
+ * @internal
+ * Moves the stream to the next value, reshuffling at the end of the batch.
+ *
+ * @param ctx the ISAAC state
+ */
+static void next_value(isaac_ctx_t* const ctx)
+{
+    ctx->stream_byte = 0;
+    if (++ctx->stream_index >= ISAAC_ELEMENTS)
+    {
+        /* Out of elements. Reshuffling and preparing new batch. */
+        isaac_shuffle(ctx);
+        ctx->stream_index = 0;
+    }
+}
+
+/**
+ * @internal
+ * Skips the rest of the value partially output by isaac_stream_bytes(), if
+ * any, so its bytes are not output again.
+ *
+ * @param ctx the ISAAC state
+ */
+static void skip_partial_value(isaac_ctx_t* const ctx)
+{
+    if (ctx->stream_byte)
+    {
+        next_value(ctx);
+    }
+}
+
+/**
+ * @internal
+ * Implementation of isaac_stream() and isaac_stream_nontemporal().
+ *
+ * The rest of the current batch is copied from ctx->result, then the
+ * batches fully requested are generated straight into ints, without passing
+ * through ctx->result, which gets only the batch of the last values.
+ */
+static void stream(isaac_ctx_t* const ctx,
+                   isaac_uint_t* ints,
+                   size_t amount,
+                   const bool nontemporal)
+{
+    uint_fast16_t available;
+    skip_partial_value(ctx);
+    while (amount)
     {
-        ISAAC_STEP(~(a ^ (a << 21U)), a, b, mm, m, m2, r, x);
-        ISAAC_STEP(a ^ (a >> 5U), a, b, mm, m, m2, r, x);
-        ISAAC_STEP(a ^ (a << 12U), a, b, mm, m, m2, r, x);
-        ISAAC_STEP(a ^ (a >> 33U), a, b, mm, m, m2, r, x);
+        available = ISAAC_MIN(ISAAC_ELEMENTS - ctx->stream_index, amount);
+        amount -= available;
+        while (available--)
+        {
+            *ints++ = ctx->result[ctx->stream_index++];
+        };
+        if (ctx->stream_index >= ISAAC_ELEMENTS)
+        {
+            /* Out of elements. Whole batches go directly to the output. */
+            while (amount >= ISAAC_ELEMENTS)
+            {
+#if ISAAC_NONTEMPORAL
+                if (nontemporal)
+                {
+                    isaac_shuffle_to_nt(ctx, ints);
+                }
+                else
+#endif
+                {
+                    isaac_shuffle_to(ctx, ints);
+                }
+                ints += ISAAC_ELEMENTS;
+                amount -= ISAAC_ELEMENTS;
+            }
+            /* Reshuffling and preparing new batch. */
+            isaac_shuffle(ctx);
+            ctx->stream_index = 0;
+        }
     }
-    for (m2 = mm; m2 < mend;)
+#if ISAAC_NONTEMPORAL
+    if (nontemporal)
     {
-        ISAAC_STEP(~(a ^ (a << 21U)), a, b, mm, m, m2, r, x);
-        ISAAC_STEP(a ^ (a >> 5U), a, b, mm, m, m2, r, x);
-        ISAAC_STEP(a ^ (a << 12U), a, b, mm, m, m2, r, x);
-        ISAAC_STEP(a ^ (a >> 33U), a, b, mm, m, m2, r, x);
+        /* Non-temporal stores are weakly ordered: make them visible. */
+        _mm_sfence();
     }
 #else
-    for (m = mm, mend = m2 = m + (ISAAC_ELEMENTS / 2U); m < mend;)
+    (void) nontemporal;
+#endif
+}
+
+void isaac_stream(isaac_ctx_t* const ctx, isaac_uint_t* const ints,
+                  const size_t amount)
+{
+    if (ctx == NULL || ints == NULL)
+    {
+        return;
+    }
+    stream(ctx, ints, amount, false);
+}
+
+void isaac_stream_nontemporal(isaac_ctx_t* const ctx,
+                              isaac_uint_t* const ints,
+                              const size_t amount)
+{
+    if (ctx == NULL || ints == NULL)
+    {
+        return;
+    }
+    stream(ctx, ints, amount, true);
+}
+
+const isaac_uint_t* isaac_stream_view(isaac_ctx_t* const ctx,
+                                      size_t* const available)
+{
+    if (ctx == NULL || available == NULL)
+    {
+        if (available != NULL)
+        {
+            *available = 0;
+        }
+        return NULL;
+    }
+    skip_partial_value(ctx);
+    *available = ISAAC_ELEMENTS - ctx->stream_index;
+    return &ctx->result[ctx->stream_index];
+}
+
+void isaac_stream_consume(isaac_ctx_t* const ctx, size_t amount)
+{
+    if (ctx == NULL)
     {
-        ISAAC_STEP(a << 13U, a, b, mm, m, m2, r, x);
-        ISAAC_STEP(a >> 6U, a, b, mm, m, m2, r, x);
-        ISAAC_STEP(a << 2U, a, b, mm, m, m2, r, x);
-        ISAAC_STEP(a >> 16U, a, b, mm, m, m2, r, x);
+        return;
+    }
+    skip_partial_value(ctx);
+    amount = ISAAC_MIN(ISAAC_ELEMENTS - ctx->stream_index, amount);
+    ctx->stream_index += (isaac_uint_t) amount;
+    if (ctx->stream_index >= ISAAC_ELEMENTS)
+    {
+        /* Out of elements. Reshuffling and preparing new batch. */
+        isaac_shuffle(ctx);
+        ctx->stream_index = 0;
+    }
+}
+
+void isaac_discard(isaac_ctx_t* const ctx, uint64_t amount)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+    skip_partial_value(ctx);
+    const uint64_t available = ISAAC_ELEMENTS - ctx->stream_index;
+    if (amount < available)
+    {
+        ctx->stream_index += (isaac_uint_t) amount;
+        return;
     }
-    for (m2 = mm; m2 < mend;)
+    /* Out of elements. Only the batch of the last values is needed, the
+     * skipped whole batches just advance the state. */
+    amount -= available;
+    for (uint64_t batches = amount / ISAAC_ELEMENTS; batches; batches--)
     {
-        ISAAC_STEP(a << 13U, a, b, mm, m, m2, r, x);
-        ISAAC_STEP(a >> 6U, a, b, mm, m, m2, r, x);
-        ISAAC_STEP(a << 2U, a, b, mm, m, m2, r, x);
-        ISAAC_STEP(a >> 16U, a, b, mm, m, m2, r, x);
+        isaac_shuffle_discard(ctx);
     }
+    isaac_shuffle(ctx);
+    ctx->stream_index = (isaac_uint_t) (amount % ISAAC_ELEMENTS);
+}
+
+/**
+ * @internal
+ * Mixing of `a` at the given step of a batch, as done by ISAAC_ROUND().
+ */
+static inline isaac_uint_t lean_mix(const isaac_uint_t a,
+                                    const uint_fast16_t step)
+{
+    switch (step & 3U)
+    {
+#if ISAAC_BITS > 32
+        case 0:
+            return ~(a ^ (a << 21U));
+        case 1:
+            return a ^ (a >> 5U);
+        case 2:
+            return a ^ (a << 12U);
+        default:
+            return a ^ (a >> 33U);
+#else
+        case 0:
+            return a ^ (a << 13U);
+        case 1:
+            return a ^ (a >> 6U);
+        case 2:
+            return a ^ (a << 2U);
+        default:
+            return a ^ (a >> 16U);
 #endif
-    ctx->b = b;
+    }
+}
+
+/**
+ * @internal
+ * Runs the next step of the reshuffle of a lean context, returning the
+ * value it generates: the same one isaac_shuffle() writes into
+ * `result[step]`.
+ *
+ * Each step only depends on the previous ones, so running them one at the
+ * time on demand gives the same values as a whole reshuffle at once.
+ */
+static isaac_uint_t lean_step(isaac_lean_ctx_t* const ctx)
+{
+    const uint_fast16_t step = ctx->index;
+    isaac_uint_t* const mm = ctx->mem;
+    isaac_uint_t a = ctx->a;
+    isaac_uint_t b = ctx->b;
+    if (step == 0)
+    {
+        b += ++ctx->c;
+    }
+    const isaac_uint_t x = mm[step];
+    a = lean_mix(a, step)
+        + mm[(step + ISAAC_ELEMENTS / 2U) & (ISAAC_ELEMENTS - 1U)];
+    const isaac_uint_t y = ISAAC_IND(mm, x) + a + b;
+    mm[step] = y;
+    b = ISAAC_IND(mm, y >> 8U) + x;
     ctx->a = a;
+    ctx->b = b;
+    ctx->index = (step + 1U) & (ISAAC_ELEMENTS - 1U);
+    return b;
 }
 
-#define ISAAC_MIN(a, b) ((a) < (b)) ? (a) : (b)
+void isaac_lean_init(isaac_lean_ctx_t* const ctx,
+                     const uint8_t* const seed,
+                     const uint16_t seed_bytes)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+    isaac_uint_t seed_values[ISAAC_ELEMENTS];
+    set_seed(seed_values, seed, seed_bytes);
+    init_state(ctx->mem, seed_values);
+    ctx->a = ctx->b = ctx->c = 0;
+    ctx->index = 0;
+    memset(seed_values, 0, sizeof(seed_values));
+}
 
-void isaac_stream(isaac_ctx_t* const ctx, isaac_uint_t* ints, size_t amount)
+void isaac_lean_stream(isaac_lean_ctx_t* const ctx,
+                       isaac_uint_t* ints,
+                       size_t amount)
 {
     if (ctx == NULL || ints == NULL)
     {
         return;
     }
-    uint_fast16_t available;
-    while (amount)
+    /* Rest of the current batch, one step at the time. */
+    while (amount && ctx->index != 0)
     {
-        available = ISAAC_MIN(ISAAC_ELEMENTS - ctx->stream_index, amount);
-        amount -= available;
-        while (available--)
+        *ints++ = lean_step(ctx);
+        amount--;
+    }
+    /* Whole batches, generated directly into the output. */
+    while (amount >= ISAAC_ELEMENTS)
+    {
+        ISAAC_SHUFFLE(ctx, ints, ISAAC_STORE);
+        amount -= ISAAC_ELEMENTS;
+    }
+    /* Start of the next batch. */
+    while (amount--)
+    {
+        *ints++ = lean_step(ctx);
+    }
+}
+
+_Static_assert(
+        sizeof(isaac_lean_ctx_t) % sizeof(isaac_uint_t) == 0,
+        "The lean ISAAC context size must be divisible by isaac_uint_t, "
+        "otherwise the cleanup function will write beyond its end.");
+
+void isaac_lean_cleanup(isaac_lean_ctx_t* const ctx)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+    isaac_uint_t* words = (isaac_uint_t*) ctx;
+    const isaac_uint_t* const end =
+            words + sizeof(*ctx) / sizeof(isaac_uint_t);
+    do
+    {
+        *words++ = 0UL;
+    }
+    while (words < end);
+}
+
+/**
+ * @internal
+ * Extracts a byte of a value, as found at the given position after
+ * converting the value to bytes in the given byte order.
+ */
+static uint8_t value_byte(const isaac_uint_t value,
+                          const uint_fast8_t position,
+                          const isaac_byte_order_t order)
+{
+    uint_fast8_t shift = (uint_fast8_t) (8U * position);
+    if (order == ISAAC_BIG_ENDIAN)
+    {
+        shift = (uint_fast8_t) (8U * (sizeof(isaac_uint_t) - 1U) - shift);
+    }
+    return (uint8_t) (value >> shift);
+}
+
+/**
+ * @internal
+ * Outputs the next bytes of the current value, from the first one not output
+ * yet, up to the end of the value or of the requested amount.
+ *
+ * @return amount of bytes written.
+ */
+static size_t value_bytes(isaac_ctx_t* const ctx,
+                          uint8_t* const bytes,
+                          const size_t amount,
+                          const isaac_byte_order_t order)
+{
+    const isaac_uint_t value = ctx->result[ctx->stream_index];
+    size_t written = 0;
+    while (written < amount && ctx->stream_byte < sizeof(isaac_uint_t))
+    {
+        bytes[written++] = value_byte(
+                value, (uint_fast8_t) ctx->stream_byte++, order);
+    }
+    ctx->stream_byte_order = order;
+    if (ctx->stream_byte >= sizeof(isaac_uint_t))
+    {
+        next_value(ctx);
+    }
+    return written;
+}
+
+void isaac_stream_bytes(isaac_ctx_t* const ctx,
+                        uint8_t* bytes,
+                        size_t amount,
+                        const isaac_byte_order_t order)
+{
+    if (ctx == NULL || bytes == NULL
+        || (order != ISAAC_LITTLE_ENDIAN && order != ISAAC_BIG_ENDIAN))
+    {
+        return;
+    }
+    size_t written;
+    size_t values;
+    if (ctx->stream_byte && ctx->stream_byte_order != (isaac_uint_t) order)
+    {
+        skip_partial_value(ctx);
+    }
+    if (ctx->stream_byte)
+    {
+        written = value_bytes(ctx, bytes, amount, order);
+        bytes += written;
+        amount -= written;
+    }
+    /* Whole values, converted straight from the current batch. */
+    while (amount >= sizeof(isaac_uint_t))
+    {
+        values = ISAAC_MIN(ISAAC_ELEMENTS - ctx->stream_index,
+                           amount / sizeof(isaac_uint_t));
+        if (order == ISAAC_BIG_ENDIAN)
         {
-            *ints++ = ctx->result[ctx->stream_index++];
-        };
+            isaac_to_big_endian(bytes, &ctx->result[ctx->stream_index],
+                                values);
+        }
+        else
+        {
+            isaac_to_little_endian(bytes, &ctx->result[ctx->stream_index],
+                                   values);
+        }
+        bytes += values * sizeof(isaac_uint_t);
+        amount -= values * sizeof(isaac_uint_t);
+        ctx->stream_index += (isaac_uint_t) values;
         if (ctx->stream_index >= ISAAC_ELEMENTS)
         {
-            /* Out of elements. Reshuffling and preparing new batch. */
+            /* Out of elements. Whole batches are serialised directly into
+             * the output while being generated. */
+            while (amount >= ISAAC_ELEMENTS * sizeof(isaac_uint_t))
+            {
+                if (order == ISAAC_BIG_ENDIAN)
+                {
+                    isaac_shuffle_to_big_endian(ctx, bytes);
+                }
+                else
+                {
+                    isaac_shuffle_to_little_endian(ctx, bytes);
+                }
+                bytes += ISAAC_ELEMENTS * sizeof(isaac_uint_t);
+                amount -= ISAAC_ELEMENTS * sizeof(isaac_uint_t);
+            }
+            /* Reshuffling and preparing new batch. */
             isaac_shuffle(ctx);
             ctx->stream_index = 0;
         }
     }
+    /* Start of the last value, whose remaining bytes are kept for later. */
+    if (amount)
+    {
+        value_bytes(ctx, bytes, amount, order);
+    }
+}
+
+void isaac_stream_little_endian(isaac_ctx_t* const ctx,
+                                uint8_t* const bytes,
+                                const size_t amount)
+{
+    isaac_stream_bytes(ctx, bytes, amount, ISAAC_LITTLE_ENDIAN);
+}
+
+void isaac_stream_big_endian(isaac_ctx_t* const ctx,
+                             uint8_t* const bytes,
+                             const size_t amount)
+{
+    isaac_stream_bytes(ctx, bytes, amount, ISAAC_BIG_ENDIAN);
 }
 
 #define ISAAC_CTX_LEN_IN_UINTS (sizeof(isaac_ctx_t) / sizeof(isaac_uint_t))
@@ -284,6 +995,143 @@ void isaac_cleanup(isaac_ctx_t* const ctx)
     while (casted < end);
 }
 
+#if ISAAC_HOST_LITTLE_ENDIAN || ISAAC_HOST_BIG_ENDIAN
+#if ISAAC_KERNEL_X86
+/* Shuffle of a 16 bytes vector reversing the bytes of each isaac_uint_t. */
+#if ISAAC_BITS > 32
+#define ISAAC_BSWAP_SHUFFLE \
+    _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7)
+#else
+#define ISAAC_BSWAP_SHUFFLE \
+    _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3)
+#endif
+
+/**
+ * @internal
+ * Reverses the bytes of each value with SSSE3 byte shuffles, 16 bytes at the
+ * time.
+ *
+ * @return amount of values converted, the rest is left to the caller.
+ */
+ISAAC_TARGET("sse4.1")
+static size_t reverse_bytes_sse4(uint8_t* const bytes,
+                                 const isaac_uint_t* const values,
+                                 const size_t amount_of_values)
+{
+    const size_t vectors =
+            amount_of_values * sizeof(isaac_uint_t) / sizeof(__m128i);
+    const __m128i reverse = ISAAC_BSWAP_SHUFFLE;
+    size_t i;
+    for (i = 0; i < vectors; i++)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*) values + i);
+        _mm_storeu_si128((__m128i*) bytes + i, _mm_shuffle_epi8(v, reverse));
+    }
+    return vectors * sizeof(__m128i) / sizeof(isaac_uint_t);
+}
+
+/**
+ * @internal
+ * Same as reverse_bytes_sse4(), 32 bytes at the time.
+ */
+ISAAC_TARGET("avx2")
+static size_t reverse_bytes_avx2(uint8_t* const bytes,
+                                 const isaac_uint_t* const values,
+                                 const size_t amount_of_values)
+{
+    const size_t vectors =
+            amount_of_values * sizeof(isaac_uint_t) / sizeof(__m256i);
+    const __m256i reverse = _mm256_broadcastsi128_si256(ISAAC_BSWAP_SHUFFLE);
+    size_t i;
+    for (i = 0; i < vectors; i++)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i*) values + i);
+        _mm256_storeu_si256((__m256i*) bytes + i,
+                            _mm256_shuffle_epi8(v, reverse));
+    }
+    return vectors * sizeof(__m256i) / sizeof(isaac_uint_t);
+}
+#endif
+
+#if ISAAC_KERNEL_ARM
+/**
+ * @internal
+ * Reverses the bytes of each value with NEON `vrev`, 16 bytes at the time.
+ *
+ * @return amount of values converted, the rest is left to the caller.
+ */
+static size_t reverse_bytes_neon(uint8_t* const bytes,
+                                 const isaac_uint_t* const values,
+                                 const size_t amount_of_values)
+{
+    const size_t vectors =
+            amount_of_values * sizeof(isaac_uint_t) / sizeof(uint8x16_t);
+    const uint8_t* const in = (const uint8_t*) values;
+    size_t i;
+    for (i = 0; i < vectors; i++)
+    {
+        const uint8x16_t v = vld1q_u8(in + i * sizeof(uint8x16_t));
+#if ISAAC_BITS > 32
+        vst1q_u8(bytes + i * sizeof(uint8x16_t), vrev64q_u8(v));
+#else
+        vst1q_u8(bytes + i * sizeof(uint8x16_t), vrev32q_u8(v));
+#endif
+    }
+    return vectors * sizeof(uint8x16_t) / sizeof(isaac_uint_t);
+}
+#endif
+
+/**
+ * @internal
+ * Copies the values into bytes, reversing the bytes of each value, i.e.
+ * converts them to the byte order opposite to the host one.
+ *
+ * The vector kernels convert the bulk, whole words the rest.
+ */
+static void reverse_bytes(uint8_t* bytes,
+                          const isaac_uint_t* values,
+                          size_t amount_of_values)
+{
+    size_t converted;
+    switch (isaac_kernel())
+    {
+#if ISAAC_KERNEL_X86
+        case ISAAC_KERNEL_AVX512:
+        case ISAAC_KERNEL_AVX2:
+            converted = reverse_bytes_avx2(bytes, values, amount_of_values);
+            break;
+        case ISAAC_KERNEL_SSE4:
+            converted = reverse_bytes_sse4(bytes, values, amount_of_values);
+            break;
+#else
+        case ISAAC_KERNEL_AVX512:
+        case ISAAC_KERNEL_AVX2:
+        case ISAAC_KERNEL_SSE4:
+#endif
+#if ISAAC_KERNEL_ARM
+        case ISAAC_KERNEL_NEON:
+            converted = reverse_bytes_neon(bytes, values, amount_of_values);
+            break;
+#else
+        case ISAAC_KERNEL_NEON:
+#endif
+        case ISAAC_KERNEL_PORTABLE:
+        default:
+            converted = 0;
+            break;
+    }
+    bytes += converted * sizeof(isaac_uint_t);
+    values += converted;
+    amount_of_values -= converted;
+    while (amount_of_values--)
+    {
+        const isaac_uint_t reversed = reverse_value(*values++);
+        memcpy(bytes, &reversed, sizeof(reversed));
+        bytes += sizeof(reversed);
+    }
+}
+#endif
+
 void isaac_to_little_endian(uint8_t* bytes,
                             const isaac_uint_t* values,
                             size_t amount_of_values)
@@ -292,22 +1140,28 @@ void isaac_to_little_endian(uint8_t* bytes,
     {
         return;
     }
+#if ISAAC_HOST_LITTLE_ENDIAN
+    /* Already in the requested byte order: memmove allows in-place calls. */
+    memmove(bytes, values, amount_of_values * sizeof(isaac_uint_t));
+#elif ISAAC_HOST_BIG_ENDIAN
+    reverse_bytes(bytes, values, amount_of_values);
+#else
+    while (amount_of_values--)
     {
-        while (amount_of_values--)
-        {
-            *bytes++ = (uint8_t) (*values);
-            *bytes++ = (uint8_t) (*values >> 8U);
-            *bytes++ = (uint8_t) (*values >> 16U);
-            *bytes++ = (uint8_t) (*values >> 24U);
+        /* Loaded before writing, as the bytes may overwrite it in place. */
+        const isaac_uint_t value = *values++;
+        *bytes++ = (uint8_t) (value);
+        *bytes++ = (uint8_t) (value >> 8U);
+        *bytes++ = (uint8_t) (value >> 16U);
+        *bytes++ = (uint8_t) (value >> 24U);
 #if ISAAC_BITS > 32
-            *bytes++ = (uint8_t) (*values >> 32U);
-            *bytes++ = (uint8_t) (*values >> 40U);
-            *bytes++ = (uint8_t) (*values >> 48U);
-            *bytes++ = (uint8_t) (*values >> 56U);
+        *bytes++ = (uint8_t) (value >> 32U);
+        *bytes++ = (uint8_t) (value >> 40U);
+        *bytes++ = (uint8_t) (value >> 48U);
+        *bytes++ = (uint8_t) (value >> 56U);
 #endif
-            values++;
-        }
     }
+#endif
 }
 
 void isaac_to_big_endian(uint8_t* bytes,
@@ -318,17 +1172,26 @@ void isaac_to_big_endian(uint8_t* bytes,
     {
         return;
     }
+#if ISAAC_HOST_BIG_ENDIAN
+    /* Already in the requested byte order: memmove allows in-place calls. */
+    memmove(bytes, values, amount_of_values * sizeof(isaac_uint_t));
+#elif ISAAC_HOST_LITTLE_ENDIAN
+    reverse_bytes(bytes, values, amount_of_values);
+#else
     while (amount_of_values--)
     {
+        /* Loaded before writing, as the bytes may overwrite it in place. */
+        const isaac_uint_t value = *values++;
 #if ISAAC_BITS > 32
-        *bytes++ = (uint8_t) (*values >> 56U);
-        *bytes++ = (uint8_t) (*values >> 48U);
-        *bytes++ = (uint8_t) (*values >> 40U);
-        *bytes++ = (uint8_t) (*values >> 32U);
+        *bytes++ = (uint8_t) (value >> 56U);
+        *bytes++ = (uint8_t) (value >> 48U);
+        *bytes++ = (uint8_t) (value >> 40U);
+        *bytes++ = (uint8_t) (value >> 32U);
 #endif
-        *bytes++ = (uint8_t) (*values >> 24U);
-        *bytes++ = (uint8_t) (*values >> 16U);
-        *bytes++ = (uint8_t) (*values >> 8U);
-        *bytes++ = (uint8_t) (*values++);
+        *bytes++ = (uint8_t) (value >> 24U);
+        *bytes++ = (uint8_t) (value >> 16U);
+        *bytes++ = (uint8_t) (value >> 8U);
+        *bytes++ = (uint8_t) (value);
     }
+#endif
 }
@@ -0,0 +1,65 @@
+/**
+ * @file
+ *
+ * LibISAAC internal header: allocation of aligned memory.
+ *
+ * C11 `aligned_alloc()` is missing from the C runtime of MSVC, which offers
+ * `_aligned_malloc()` instead, whose memory must be released with
+ * `_aligned_free()` rather than `free()`.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#ifndef ISAAC_ALLOC_H
+#define ISAAC_ALLOC_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stddef.h>
+#include <stdlib.h>
+#if defined(_WIN32)
+#include <malloc.h>
+#endif
+
+/**
+ * @internal
+ * Allocates memory aligned to \p alignment bytes, a power of 2.
+ *
+ * @param alignment alignment of the memory in bytes
+ * @param size amount of bytes, rounded up to a multiple of \p alignment as
+ * aligned_alloc() requires
+ * @return the memory, to be released with alloc_aligned_free(), or NULL
+ */
+static inline void* alloc_aligned(const size_t alignment, size_t size)
+{
+    size = (size + alignment - 1U) / alignment * alignment;
+#if defined(_WIN32)
+    return _aligned_malloc(size, alignment);
+#else
+    return aligned_alloc(alignment, size);
+#endif
+}
+
+/**
+ * @internal
+ * Releases memory allocated with alloc_aligned(). Does nothing when NULL.
+ */
+static inline void alloc_aligned_free(void* const memory)
+{
+#if defined(_WIN32)
+    _aligned_free(memory);
+#else
+    free(memory);
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* ISAAC_ALLOC_H */
@@ -0,0 +1,263 @@
+/**
+ * @file
+ *
+ * LibISAAC double-buffered context: the next batch is generated ahead of
+ * time, either explicitly with isaac_prefetch() or by a helper thread, so
+ * the caller only copies already generated integers.
+ *
+ * The batches come from a regular ISAAC state in order, so the stream is the
+ * one of an #isaac_ctx_t with the same seed. One bank is read by the caller
+ * while the other one is empty, being filled or ready. Only whoever moves
+ * the spare bank from empty to filling advances the generator.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "isaac.h"
+#include <string.h>
+
+#if ISAAC_THREADS
+#include <pthread.h>
+#include <stdlib.h>
+#endif
+
+/* States of the spare bank. */
+#define SPARE_EMPTY 0U
+#define SPARE_FILLING 1U
+#define SPARE_READY 2U
+
+#define BUFFERED_MIN(a, b) (((a) < (b)) ? (a) : (b))
+
+#if ISAAC_THREADS
+/**
+ * @internal
+ * Helper thread filling the spare bank, with the synchronisation of the
+ * accesses to it.
+ */
+typedef struct
+{
+    pthread_t thread;
+    /** Guards the state of the spare bank and the active bank index. */
+    pthread_mutex_t lock;
+    /** Signalled when the spare bank becomes empty or on stop. */
+    pthread_cond_t wake;
+    /** Signalled when the spare bank becomes ready. */
+    pthread_cond_t ready;
+    bool stop;
+} buffered_helper_t;
+#endif
+
+/**
+ * @internal
+ * Generates the next batch into the spare bank.
+ */
+static void fill_spare(isaac_buffered_ctx_t* const bctx)
+{
+    isaac_stream(&bctx->generator, bctx->banks[1U - bctx->active],
+                 ISAAC_ELEMENTS);
+}
+
+#if ISAAC_THREADS
+/**
+ * @internal
+ * Refills the spare bank every time it is emptied, until stopped.
+ */
+static void* helper_main(void* const arg)
+{
+    isaac_buffered_ctx_t* const bctx = arg;
+    buffered_helper_t* const helper = bctx->helper;
+    pthread_mutex_lock(&helper->lock);
+    for (;;)
+    {
+        while (bctx->spare != SPARE_EMPTY && !helper->stop)
+        {
+            pthread_cond_wait(&helper->wake, &helper->lock);
+        }
+        if (helper->stop)
+        {
+            break;
+        }
+        bctx->spare = SPARE_FILLING;
+        pthread_mutex_unlock(&helper->lock);
+        fill_spare(bctx);
+        pthread_mutex_lock(&helper->lock);
+        bctx->spare = SPARE_READY;
+        pthread_cond_broadcast(&helper->ready);
+    }
+    pthread_mutex_unlock(&helper->lock);
+    return NULL;
+}
+#endif
+
+/**
+ * @internal
+ * Makes the spare bank the active one, generating it first when nobody did.
+ */
+static void next_bank(isaac_buffered_ctx_t* const bctx)
+{
+#if ISAAC_THREADS
+    buffered_helper_t* const helper = bctx->helper;
+    if (helper != NULL)
+    {
+        pthread_mutex_lock(&helper->lock);
+        while (bctx->spare == SPARE_FILLING)
+        {
+            pthread_cond_wait(&helper->ready, &helper->lock);
+        }
+        if (bctx->spare == SPARE_EMPTY)
+        {
+            fill_spare(bctx);  /* The helper fell behind. */
+        }
+        bctx->active = 1U - bctx->active;
+        bctx->index = 0;
+        bctx->spare = SPARE_EMPTY;
+        pthread_cond_signal(&helper->wake);
+        pthread_mutex_unlock(&helper->lock);
+        return;
+    }
+#endif
+    if (bctx->spare != SPARE_READY)
+    {
+        fill_spare(bctx);
+    }
+    bctx->active = 1U - bctx->active;
+    bctx->index = 0;
+    bctx->spare = SPARE_EMPTY;
+}
+
+void isaac_buffered_init(isaac_buffered_ctx_t* const bctx,
+                         const uint8_t* const seed,
+                         const uint16_t seed_bytes)
+{
+    if (bctx == NULL)
+    {
+        return;
+    }
+    isaac_init(&bctx->generator, seed, seed_bytes);
+    bctx->helper = NULL;
+    bctx->active = 0;
+    bctx->index = 0;
+    isaac_stream(&bctx->generator, bctx->banks[0], ISAAC_ELEMENTS);
+    bctx->spare = SPARE_EMPTY;
+}
+
+void isaac_buffered_stream(isaac_buffered_ctx_t* const bctx,
+                           isaac_uint_t* ints,
+                           size_t amount)
+{
+    if (bctx == NULL || ints == NULL)
+    {
+        return;
+    }
+    while (amount)
+    {
+        if (bctx->index >= ISAAC_ELEMENTS)
+        {
+            next_bank(bctx);
+        }
+        const size_t available = BUFFERED_MIN(ISAAC_ELEMENTS - bctx->index,
+                                              amount);
+        memcpy(ints, &bctx->banks[bctx->active][bctx->index],
+               available * sizeof(isaac_uint_t));
+        ints += available;
+        amount -= available;
+        bctx->index += available;
+    }
+}
+
+void isaac_prefetch(isaac_buffered_ctx_t* const bctx)
+{
+    if (bctx == NULL || bctx->helper != NULL || bctx->spare != SPARE_EMPTY)
+    {
+        return;
+    }
+    fill_spare(bctx);
+    bctx->spare = SPARE_READY;
+}
+
+bool isaac_buffered_start(isaac_buffered_ctx_t* const bctx)
+{
+    if (bctx == NULL)
+    {
+        return false;
+    }
+#if ISAAC_THREADS
+    if (bctx->helper != NULL)
+    {
+        return true;
+    }
+    buffered_helper_t* const helper = malloc(sizeof(buffered_helper_t));
+    if (helper == NULL)
+    {
+        return false;
+    }
+    helper->stop = false;
+    if (pthread_mutex_init(&helper->lock, NULL) != 0)
+    {
+        free(helper);
+        return false;
+    }
+    if (pthread_cond_init(&helper->wake, NULL) != 0)
+    {
+        pthread_mutex_destroy(&helper->lock);
+        free(helper);
+        return false;
+    }
+    if (pthread_cond_init(&helper->ready, NULL) != 0)
+    {
+        pthread_cond_destroy(&helper->wake);
+        pthread_mutex_destroy(&helper->lock);
+        free(helper);
+        return false;
+    }
+    bctx->helper = helper;
+    if (pthread_create(&helper->thread, NULL, helper_main, bctx) != 0)
+    {
+        bctx->helper = NULL;
+        pthread_cond_destroy(&helper->ready);
+        pthread_cond_destroy(&helper->wake);
+        pthread_mutex_destroy(&helper->lock);
+        free(helper);
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+void isaac_buffered_stop(isaac_buffered_ctx_t* const bctx)
+{
+#if ISAAC_THREADS
+    if (bctx == NULL || bctx->helper == NULL)
+    {
+        return;
+    }
+    buffered_helper_t* const helper = bctx->helper;
+    pthread_mutex_lock(&helper->lock);
+    helper->stop = true;
+    pthread_cond_signal(&helper->wake);
+    pthread_mutex_unlock(&helper->lock);
+    pthread_join(helper->thread, NULL);
+    pthread_cond_destroy(&helper->ready);
+    pthread_cond_destroy(&helper->wake);
+    pthread_mutex_destroy(&helper->lock);
+    free(helper);
+    bctx->helper = NULL;
+#else
+    (void) bctx;
+#endif
+}
+
+void isaac_buffered_cleanup(isaac_buffered_ctx_t* const bctx)
+{
+    if (bctx == NULL)
+    {
+        return;
+    }
+    isaac_buffered_stop(bctx);
+    isaac_cleanup(&bctx->generator);
+    memset(bctx, 0, sizeof(*bctx));
+}
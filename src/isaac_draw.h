@@ -0,0 +1,251 @@
+/**
+ * @file
+ *
+ * LibISAAC internal header: drawing random bits from the buffered stream.
+ *
+ * The functions building on top of the stream, such as the bounded integers,
+ * read the words in place from `ctx->result` with isaac_stream_view() and
+ * mark them as used with isaac_stream_consume() only once done, so a word
+ * costs a load and a comparison rather than a function call.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#ifndef ISAAC_DRAW_H
+#define ISAAC_DRAW_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "isaac.h"
+
+/**
+ * @internal
+ * Reader of the stream of an ISAAC context.
+ *
+ * Between draw_begin() and draw_end() the context must not be used in any
+ * other way.
+ */
+typedef struct
+{
+    /** The ISAAC state being read. */
+    isaac_ctx_t* ctx;
+    /** Words lent by isaac_stream_view(). */
+    const isaac_uint_t* words;
+    /** Amount of lent words. */
+    size_t available;
+    /** Amount of lent words already drawn. */
+    size_t used;
+#if ISAAC_BITS > 32
+    /** Upper half of the last word, not drawn yet by draw_u32(). */
+    uint32_t half;
+    /** True when `half` holds bits not drawn yet. */
+    bool has_half;
+#endif
+} isaac_draw_t;
+
+/**
+ * @internal
+ * Starts reading the stream of the context.
+ */
+static inline void draw_begin(isaac_draw_t* const draw, isaac_ctx_t* const ctx)
+{
+    draw->ctx = ctx;
+    draw->words = isaac_stream_view(ctx, &draw->available);
+    draw->used = 0;
+#if ISAAC_BITS > 32
+    draw->has_half = false;
+#endif
+}
+
+/**
+ * @internal
+ * Draws the next word of the stream, moving to the next batch when the lent
+ * one is used up.
+ */
+static inline isaac_uint_t draw_word(isaac_draw_t* const draw)
+{
+    if (draw->used >= draw->available)
+    {
+        isaac_stream_consume(draw->ctx, draw->used);
+        draw->words = isaac_stream_view(draw->ctx, &draw->available);
+        draw->used = 0;
+    }
+    return draw->words[draw->used++];
+}
+
+/**
+ * @internal
+ * Stops reading the stream, marking the drawn words as used.
+ *
+ * With ISAAC-64, an upper half not drawn yet by draw_u32() is discarded.
+ */
+static inline void draw_end(isaac_draw_t* const draw)
+{
+    isaac_stream_consume(draw->ctx, draw->used);
+}
+
+/**
+ * @internal
+ * Draws 32 random bits: a whole word with ISAAC, half a word with ISAAC-64,
+ * lower half first.
+ */
+static inline uint32_t draw_u32(isaac_draw_t* const draw)
+{
+#if ISAAC_BITS > 32
+    if (draw->has_half)
+    {
+        draw->has_half = false;
+        return draw->half;
+    }
+    const isaac_uint_t word = draw_word(draw);
+    draw->half = (uint32_t) (word >> 32U);
+    draw->has_half = true;
+    return (uint32_t) word;
+#else
+    return draw_word(draw);
+#endif
+}
+
+/**
+ * @internal
+ * Draws 64 random bits: a whole word with ISAAC-64, two words with ISAAC,
+ * the first one being the upper half.
+ */
+static inline uint64_t draw_u64(isaac_draw_t* const draw)
+{
+#if ISAAC_BITS > 32
+    return draw_word(draw);
+#else
+    const uint64_t upper = draw_word(draw);
+    return (upper << 32U) | draw_word(draw);
+#endif
+}
+
+/** @internal Every multiple of 2^-53 in [0, 1) is a double. */
+#define DRAW_F64_BITS 53U
+/** @internal Distance between the doubles drawn by draw_f64(). */
+#define DRAW_F64_ULP 0x1.0p-53
+
+/**
+ * @internal
+ * Converts 64 random bits to a double in [0, 1), using the upper 53 of them.
+ * Both the conversion and the scaling are exact.
+ */
+static inline double draw_to_f64(const uint64_t bits)
+{
+    return (double) (bits >> (64U - DRAW_F64_BITS)) * DRAW_F64_ULP;
+}
+
+/**
+ * @internal
+ * Draws a double in [0, 1) with draw_to_f64(), as isaac_uniform_f64() does.
+ */
+static inline double draw_f64(isaac_draw_t* const draw)
+{
+    return draw_to_f64(draw_u64(draw));
+}
+
+/**
+ * @internal
+ * Draws an integer in [0, bound), bound not 0, without bias, with Lemire's
+ * nearly-divisionless multiply-shift method.
+ *
+ * The 32 random bits are scaled to the bound with a multiplication; the
+ * few values the scaling maps unevenly are rejected and drawn again. The
+ * division computing their threshold is only needed when a draw falls
+ * close to them.
+ *
+ * Reference: D. Lemire, "Fast Random Integer Generation in an Interval",
+ * ACM Transactions on Modeling and Computer Simulation, 2019.
+ */
+static inline uint32_t draw_bounded_u32(isaac_draw_t* const draw,
+                                        const uint32_t bound)
+{
+    uint64_t m = (uint64_t) draw_u32(draw) * bound;
+    uint32_t low = (uint32_t) m;
+    if (low < bound)
+    {
+        const uint32_t threshold = (uint32_t) -bound % bound;
+        while (low < threshold)
+        {
+            m = (uint64_t) draw_u32(draw) * bound;
+            low = (uint32_t) m;
+        }
+    }
+    return (uint32_t) (m >> 32U);
+}
+
+/**
+ * @internal
+ * Full 128 bit product of two 64 bit integers.
+ *
+ * @return the upper 64 bits, the lower ones are written into \p low.
+ */
+static inline uint64_t draw_mul_128(const uint64_t a,
+                                    const uint64_t b,
+                                    uint64_t* const low)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ const unsigned __int128 m = (unsigned __int128) a * b;
+    *low = (uint64_t) m;
+    return (uint64_t) (m >> 64U);
+#else
+    const uint64_t a_lo = a & 0xFFFFFFFFU;
+    const uint64_t a_hi = a >> 32U;
+    const uint64_t b_lo = b & 0xFFFFFFFFU;
+    const uint64_t b_hi = b >> 32U;
+    const uint64_t lo_lo = a_lo * b_lo;
+    const uint64_t hi_lo = a_hi * b_lo;
+    const uint64_t lo_hi = a_lo * b_hi;
+    const uint64_t cross = (lo_lo >> 32U) + (hi_lo & 0xFFFFFFFFU) + lo_hi;
+    *low = (cross << 32U) | (lo_lo & 0xFFFFFFFFU);
+    return a_hi * b_hi + (hi_lo >> 32U) + (cross >> 32U);
+#endif
+}
+
+/**
+ * @internal
+ * Same as draw_bounded_u32(), with 64 random bits and a 64 bit bound.
+ */
+static inline uint64_t draw_bounded_u64(isaac_draw_t* const draw,
+                                        const uint64_t bound)
+{
+    uint64_t low;
+    uint64_t high = draw_mul_128(draw_u64(draw), bound, &low);
+    if (low < bound)
+    {
+        const uint64_t threshold = -bound % bound;
+        while (low < threshold)
+        {
+            high = draw_mul_128(draw_u64(draw), bound, &low);
+        }
+    }
+    return high;
+}
+
+/**
+ * @internal
+ * Draws an index in [0, bound), bound not 0, without bias, with 32 random
+ * bits when the bound fits in them.
+ */
+static inline size_t draw_index(isaac_draw_t* const draw, const size_t bound)
+{
+#if SIZE_MAX > UINT32_MAX
+    if (bound > UINT32_MAX)
+    {
+        return (size_t) draw_bounded_u64(draw, bound);
+    }
+#endif
+    return draw_bounded_u32(draw, (uint32_t) bound);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* ISAAC_DRAW_H */
@@ -0,0 +1,124 @@
+/**
+ * @file
+ *
+ * LibISAAC runtime selection of the vector kernels.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "isaac_kernel.h"
+#include <string.h>
+
+static const char* const kernel_names[] = {
+        [ISAAC_KERNEL_PORTABLE] = "portable",
+        [ISAAC_KERNEL_SSE4] = "sse4",
+        [ISAAC_KERNEL_AVX2] = "avx2",
+        [ISAAC_KERNEL_AVX512] = "avx512",
+        [ISAAC_KERNEL_NEON] = "neon",
+};
+
+#define KERNELS_AMOUNT (sizeof(kernel_names) / sizeof(kernel_names[0]))
+
+#if ISAAC_KERNEL_X86 || ISAAC_KERNEL_ARM
+/** More than one kernel family can run: the choice is stored at runtime. */
+#define ISAAC_KERNEL_CHOICE 1
+#include <stdatomic.h>
+
+/* Selected kernel family, negative when not detected yet. Concurrent first
+ * calls all detect and store the same value. */
+static atomic_int selected_kernel = -1;
+#else
+#define ISAAC_KERNEL_CHOICE 0
+#endif
+
+/**
+ * @internal
+ * Finds the widest kernel family supported by the running CPU and OS.
+ */
+static isaac_kernel_t detect_kernel(void)
+{
+#if ISAAC_KERNEL_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return ISAAC_KERNEL_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return ISAAC_KERNEL_AVX2;
+    }
+    if (__builtin_cpu_supports("sse4.1"))
+    {
+        return ISAAC_KERNEL_SSE4;
+    }
+#elif ISAAC_KERNEL_ARM
+    return ISAAC_KERNEL_NEON;
+#endif
+    return ISAAC_KERNEL_PORTABLE;
+}
+
+/**
+ * @internal
+ * Tells whether a kernel family can run, given the widest one supported.
+ */
+static bool kernel_supported(const size_t kernel, const isaac_kernel_t widest)
+{
+    if (kernel == ISAAC_KERNEL_PORTABLE || kernel == (size_t) widest)
+    {
+        return true;
+    }
+    /* Narrower x86 families run on CPUs supporting wider ones. */
+    return widest <= ISAAC_KERNEL_AVX512
+           && kernel <= (size_t) widest;
+}
+
+isaac_kernel_t isaac_kernel(void)
+{
+#if ISAAC_KERNEL_CHOICE
+    int kernel = atomic_load_explicit(&selected_kernel, memory_order_relaxed);
+    if (kernel < 0)
+    {
+        kernel = (int) detect_kernel();
+        atomic_store_explicit(&selected_kernel, kernel, memory_order_relaxed);
+    }
+    return (isaac_kernel_t) kernel;
+#else
+    return ISAAC_KERNEL_PORTABLE;
+#endif
+}
+
+const char* isaac_kernel_name(void)
+{
+    return kernel_names[isaac_kernel()];
+}
+
+bool isaac_kernel_select(const char* const name)
+{
+    const isaac_kernel_t widest = detect_kernel();
+    size_t kernel;
+    if (name == NULL)
+    {
+        kernel = (size_t) widest;
+    }
+    else
+    {
+        for (kernel = 0; kernel < KERNELS_AMOUNT; kernel++)
+        {
+            if (strcmp(name, kernel_names[kernel]) == 0)
+            {
+                break;
+            }
+        }
+        if (kernel >= KERNELS_AMOUNT || !kernel_supported(kernel, widest))
+        {
+            return false;
+        }
+    }
+#if ISAAC_KERNEL_CHOICE
+    atomic_store_explicit(&selected_kernel, (int) kernel,
+                          memory_order_relaxed);
+#endif
+    return true;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file
+ *
+ * LibISAAC internal header: runtime selection of the vector kernels.
+ *
+ * The library is compiled for the baseline instruction set of the target.
+ * Kernels using wider instruction sets are compiled with a function-level
+ * `target` attribute and called only when the running CPU supports them, so
+ * a single binary runs everywhere and uses the fastest path available.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#ifndef ISAAC_KERNEL_H
+#define ISAAC_KERNEL_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include "isaac.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) \
+    && (defined(__x86_64__) || defined(__i386__))
+/** The x86 vector kernels can be compiled and selected at runtime. */
+#define ISAAC_KERNEL_X86 1
+#include <immintrin.h>
+/** Compiles a function for the given instruction set, e.g. "avx2". */
+#define ISAAC_TARGET(isa) __attribute__((target(isa)))
+#else
+#define ISAAC_KERNEL_X86 0
+#endif
+
+#if (defined(__GNUC__) || defined(__clang__)) && defined(__ARM_NEON)
+/** The ARM NEON kernels can be compiled: NEON is part of the target. */
+#define ISAAC_KERNEL_ARM 1
+#include <arm_neon.h>
+#else
+#define ISAAC_KERNEL_ARM 0
+#endif
+
+/**
+ * @internal
+ * Kernel families. The x86 ones are sorted by increasing instruction set
+ * requirements.
+ */
+typedef enum
+{
+    /** Plain C, any CPU. */
+    ISAAC_KERNEL_PORTABLE = 0,
+    /** x86 with SSE4.1 (and thus SSSE3). */
+    ISAAC_KERNEL_SSE4 = 1,
+    /** x86 with AVX2. */
+    ISAAC_KERNEL_AVX2 = 2,
+    /** x86 with AVX-512F. */
+    ISAAC_KERNEL_AVX512 = 3,
+    /** ARM with NEON. */
+    ISAAC_KERNEL_NEON = 4,
+} isaac_kernel_t;
+
+/**
+ * @internal
+ * Kernel family to use, as detected on the running CPU or as forced with
+ * isaac_kernel_select().
+ */
+isaac_kernel_t isaac_kernel(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* ISAAC_KERNEL_H */
@@ -0,0 +1,527 @@
+/**
+ * @file
+ *
+ * LibISAAC multi-lane implementation: advances several independently seeded
+ * ISAAC states together, using vector instructions when available.
+ *
+ * The lanes are stored interleaved, so that the same step of all lanes
+ * sits in consecutive memory and can be loaded, mixed and stored with a
+ * single vector instruction. The indirect lookups `ISAAC_IND` become vector
+ * gathers, as every lane reads from its own column of the interleaved state.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "isaac.h"
+#include "isaac_kernel.h"
+#include "isaac_mix.h"
+#include <string.h>
+
+#if ISAAC_BITS > 32
+#define LANES_IND_SHIFT 3U
+#define LANES_MIX_0(a) (~((a) ^ ((a) << 21U)))
+#define LANES_MIX_1(a) ((a) ^ ((a) >> 5U))
+#define LANES_MIX_2(a) ((a) ^ ((a) << 12U))
+#define LANES_MIX_3(a) ((a) ^ ((a) >> 33U))
+#else
+#define LANES_IND_SHIFT 2U
+#define LANES_MIX_0(a) ((a) ^ ((a) << 13U))
+#define LANES_MIX_1(a) ((a) ^ ((a) >> 6U))
+#define LANES_MIX_2(a) ((a) ^ ((a) << 2U))
+#define LANES_MIX_3(a) ((a) ^ ((a) >> 16U))
+#endif
+
+/* Index of value i of a lane in the interleaved arrays, relative to the
+ * lane's column. */
+#define LANES_AT(i, log2) ((((i) & (ISAAC_ELEMENTS - 1U))) << (log2))
+
+#define LANES_IND(mm, x, lane, log2) \
+    ((mm)[LANES_AT((x) >> LANES_IND_SHIFT, log2) + (lane)])
+
+/* Same as ISAAC_STEP, for a single lane of the interleaved state. */
+#define LANES_STEP(mix, a, b, mm, r, i, lane, log2, x, y) \
+{ \
+    x = (mm)[LANES_AT(i, log2) + (lane)]; \
+    a = (mix) + (mm)[LANES_AT((i) + ISAAC_ELEMENTS / 2U, log2) + (lane)]; \
+    (mm)[LANES_AT(i, log2) + (lane)] = y = \
+            LANES_IND(mm, x, lane, log2) + a + b; \
+    (r)[LANES_AT(i, log2) + (lane)] = b = \
+            LANES_IND(mm, y >> 8U, lane, log2) + x; \
+}
+
+/* Gather indices of ISAAC_IND for a vector of lanes, whose column offsets
+ * relative to the first lane of the vector are in iota. */
+#define LANES_VIND(v, log2, iota) \
+    (((((v) >> LANES_IND_SHIFT) & (ISAAC_ELEMENTS - 1U)) << (log2)) + (iota))
+
+/* Same as ISAAC_STEP, for a vector of adjacent lanes of the interleaved
+ * state. The new mem[] value is stored before the second gather, exactly as
+ * the scalar step does. */
+#define LANES_VSTEP(mix, a, b, mm, r, i, log2, iota, x, y) \
+{ \
+    memcpy(&(x), (mm) + LANES_AT(i, log2), sizeof(x)); \
+    memcpy(&(y), (mm) + LANES_AT((i) + ISAAC_ELEMENTS / 2U, log2), \
+           sizeof(y)); \
+    a = (mix) + y; \
+    y = LANES_KERNEL_GATHER((mm), LANES_VIND(x, log2, iota)) + a + b; \
+    memcpy((mm) + LANES_AT(i, log2), &(y), sizeof(y)); \
+    b = LANES_KERNEL_GATHER((mm), LANES_VIND(y >> 8U, log2, iota)) + x; \
+    memcpy((r) + LANES_AT(i, log2), &(b), sizeof(b)); \
+}
+
+#define ISAAC_MIN(a, b) (((a) < (b)) ? (a) : (b))
+
+/**
+ * @internal
+ * Permutes all lanes of an interleaved ISAAC state, one lane at a time.
+ *
+ * Portable fallback of the vector kernels, producing the same output.
+ *
+ * @param mem interleaved ISAAC internal state of all lanes
+ * @param result interleaved output of all lanes
+ * @param la `a` values of all lanes
+ * @param lb `b` values of all lanes
+ * @param lc `c` values of all lanes
+ * @param log2 base 2 logarithm of the amount of lanes
+ */
+static void lanes_shuffle_portable(isaac_uint_t* const mem,
+                                   isaac_uint_t* const result,
+                                   isaac_uint_t* const la,
+                                   isaac_uint_t* const lb,
+                                   isaac_uint_t* const lc,
+                                   const unsigned int log2)
+{
+    const uint_fast16_t lanes = 1U << log2;
+    uint_fast16_t lane;
+    uint_fast16_t i;
+    isaac_uint_t a;
+    isaac_uint_t b;
+    isaac_uint_t x;
+    isaac_uint_t y;
+    for (lane = 0; lane < lanes; lane++)
+    {
+        a = la[lane];
+        b = lb[lane] + (++lc[lane]);
+        for (i = 0; i < ISAAC_ELEMENTS; i += 4)
+        {
+            LANES_STEP(LANES_MIX_0(a), a, b, mem, result, i + 0U, lane, log2,
+                       x, y);
+            LANES_STEP(LANES_MIX_1(a), a, b, mem, result, i + 1U, lane, log2,
+                       x, y);
+            LANES_STEP(LANES_MIX_2(a), a, b, mem, result, i + 2U, lane, log2,
+                       x, y);
+            LANES_STEP(LANES_MIX_3(a), a, b, mem, result, i + 3U, lane, log2,
+                       x, y);
+        }
+        la[lane] = a;
+        lb[lane] = b;
+    }
+}
+
+#if ISAAC_KERNEL_X86
+#if ISAAC_BITS > 32
+#define LANES_KERNEL_NAME lanes_shuffle_avx2
+#define LANES_KERNEL_INIT_NAME lanes_init_passes_avx2
+#define LANES_KERNEL_TARGET ISAAC_TARGET("avx2")
+#define LANES_KERNEL_WIDTH 4U
+#define LANES_KERNEL_GATHER(base, idx) \
+    ((lanes_vec_avx2_t) _mm256_i64gather_epi64( \
+        (const long long*) (base), (__m256i) (idx), 8))
+typedef isaac_uint_t lanes_vec_avx2_t
+        __attribute__((vector_size(LANES_KERNEL_WIDTH * sizeof(isaac_uint_t))));
+#define LANES_KERNEL_VEC lanes_vec_avx2_t
+#include "isaac_lanes_kernel.h"
+
+#define LANES_KERNEL_NAME lanes_shuffle_avx512
+#define LANES_KERNEL_INIT_NAME lanes_init_passes_avx512
+#define LANES_KERNEL_TARGET ISAAC_TARGET("avx512f")
+#define LANES_KERNEL_WIDTH 8U
+#define LANES_KERNEL_GATHER(base, idx) \
+    ((lanes_vec_avx512_t) _mm512_i64gather_epi64( \
+        (__m512i) (idx), (const void*) (base), 8))
+typedef isaac_uint_t lanes_vec_avx512_t
+        __attribute__((vector_size(LANES_KERNEL_WIDTH * sizeof(isaac_uint_t))));
+#define LANES_KERNEL_VEC lanes_vec_avx512_t
+#include "isaac_lanes_kernel.h"
+#else
+#define LANES_KERNEL_NAME lanes_shuffle_avx2
+#define LANES_KERNEL_TARGET ISAAC_TARGET("avx2")
+#define LANES_KERNEL_WIDTH 4U
+#define LANES_KERNEL_GATHER(base, idx) \
+    ((lanes_vec_avx2_t) _mm_i32gather_epi32( \
+        (const int*) (base), (__m128i) (idx), 4))
+typedef isaac_uint_t lanes_vec_avx2_t
+        __attribute__((vector_size(LANES_KERNEL_WIDTH * sizeof(isaac_uint_t))));
+#define LANES_KERNEL_VEC lanes_vec_avx2_t
+#include "isaac_lanes_kernel.h"
+
+#define LANES_KERNEL_NAME lanes_shuffle_avx2_wide
+#define LANES_KERNEL_INIT_NAME lanes_init_passes_avx2_wide
+#define LANES_KERNEL_TARGET ISAAC_TARGET("avx2")
+#define LANES_KERNEL_WIDTH 8U
+#define LANES_KERNEL_GATHER(base, idx) \
+    ((lanes_vec_avx2_wide_t) _mm256_i32gather_epi32( \
+        (const int*) (base), (__m256i) (idx), 4))
+typedef isaac_uint_t lanes_vec_avx2_wide_t
+        __attribute__((vector_size(LANES_KERNEL_WIDTH * sizeof(isaac_uint_t))));
+#define LANES_KERNEL_VEC lanes_vec_avx2_wide_t
+#include "isaac_lanes_kernel.h"
+#endif
+#endif
+
+/**
+ * @internal
+ * Permutes all lanes of an interleaved ISAAC state with the widest kernel
+ * selected at runtime that fits the amount of lanes.
+ *
+ * The SSE4 family has no gather instruction and uses the portable kernel.
+ */
+static void lanes_shuffle(isaac_uint_t* const mem,
+                          isaac_uint_t* const result,
+                          isaac_uint_t* const la,
+                          isaac_uint_t* const lb,
+                          isaac_uint_t* const lc,
+                          const unsigned int log2)
+{
+    switch (isaac_kernel())
+    {
+#if ISAAC_KERNEL_X86
+        case ISAAC_KERNEL_AVX512:
+#if ISAAC_BITS > 32
+            if (log2 >= 3U)
+            {
+                lanes_shuffle_avx512(mem, result, la, lb, lc, log2);
+                break;
+            }
+#endif
+            /* Fall through - AVX2 is the widest kernel for these lanes. */
+        case ISAAC_KERNEL_AVX2:
+#if ISAAC_BITS == 32
+            if (log2 >= 3U)
+            {
+                lanes_shuffle_avx2_wide(mem, result, la, lb, lc, log2);
+                break;
+            }
+#endif
+            lanes_shuffle_avx2(mem, result, la, lb, lc, log2);
+            break;
+#else
+        case ISAAC_KERNEL_AVX512:
+        case ISAAC_KERNEL_AVX2:
+#endif
+        case ISAAC_KERNEL_SSE4:
+        case ISAAC_KERNEL_NEON:
+        case ISAAC_KERNEL_PORTABLE:
+        default:
+            lanes_shuffle_portable(mem, result, la, lb, lc, log2);
+            break;
+    }
+}
+
+/**
+ * @internal
+ * Initialises every lane of an interleaved ISAAC state as isaac_init() does.
+ */
+static void lanes_init(isaac_uint_t* const mem,
+                       isaac_uint_t* const result,
+                       isaac_uint_t* const la,
+                       isaac_uint_t* const lb,
+                       isaac_uint_t* const lc,
+                       isaac_uint_t* const stream_index,
+                       const unsigned int log2,
+                       const uint8_t* const* const seeds,
+                       const uint16_t* const seed_bytes)
+{
+    const uint_fast16_t lanes = 1U << log2;
+    uint_fast16_t lane;
+    uint_fast16_t i;
+    isaac_ctx_t lane_ctx;
+    for (lane = 0; lane < lanes; lane++)
+    {
+        isaac_init(&lane_ctx,
+                   seeds == NULL ? NULL : seeds[lane],
+                   seed_bytes == NULL ? 0U : seed_bytes[lane]);
+        for (i = 0; i < ISAAC_ELEMENTS; i++)
+        {
+            mem[LANES_AT(i, log2) + lane] = lane_ctx.mem[i];
+            result[LANES_AT(i, log2) + lane] = lane_ctx.result[i];
+        }
+        la[lane] = lane_ctx.a;
+        lb[lane] = lane_ctx.b;
+        lc[lane] = lane_ctx.c;
+    }
+    isaac_cleanup(&lane_ctx);
+    *stream_index = 0;
+}
+
+/**
+ * @internal
+ * Copies the next values of every lane into their buffers, reshuffling all
+ * lanes together when the batch is exhausted.
+ */
+static void lanes_stream(isaac_uint_t* const mem,
+                         isaac_uint_t* const result,
+                         isaac_uint_t* const la,
+                         isaac_uint_t* const lb,
+                         isaac_uint_t* const lc,
+                         isaac_uint_t* const stream_index,
+                         const unsigned int log2,
+                         isaac_uint_t* const* const ints,
+                         size_t amount)
+{
+    const uint_fast16_t lanes = 1U << log2;
+    uint_fast16_t lane;
+    uint_fast16_t available;
+    uint_fast16_t i;
+    size_t produced = 0;
+    while (amount)
+    {
+        available = ISAAC_MIN(ISAAC_ELEMENTS - *stream_index, amount);
+        amount -= available;
+        for (lane = 0; lane < lanes; lane++)
+        {
+            if (ints[lane] != NULL)
+            {
+                for (i = 0; i < available; i++)
+                {
+                    ints[lane][produced + i] =
+                            result[LANES_AT(*stream_index + i, log2) + lane];
+                }
+            }
+        }
+        produced += available;
+        *stream_index += (isaac_uint_t) available;
+        if (*stream_index >= ISAAC_ELEMENTS)
+        {
+            /* Out of elements. Reshuffling and preparing new batch. */
+            lanes_shuffle(mem, result, la, lb, lc, log2);
+            *stream_index = 0;
+        }
+    }
+}
+
+/**
+ * @internal
+ * Erases a multi-lane context value by value, as isaac_cleanup() does.
+ */
+static void lanes_cleanup(isaac_uint_t* words, const size_t amount)
+{
+    const isaac_uint_t* const end = words + amount;
+    do
+    {
+        *words++ = 0UL;
+    }
+    while (words < end);
+}
+
+_Static_assert(
+        sizeof(isaac_x4_ctx_t) % sizeof(isaac_uint_t) == 0,
+        "The ISAAC x4 context size must be divisible by isaac_uint_t, "
+        "otherwise the cleanup function will write beyond its end.");
+_Static_assert(
+        sizeof(isaac_x8_ctx_t) % sizeof(isaac_uint_t) == 0,
+        "The ISAAC x8 context size must be divisible by isaac_uint_t, "
+        "otherwise the cleanup function will write beyond its end.");
+
+#define LANES_X4_LOG2 2U
+_Static_assert((1U << LANES_X4_LOG2) == ISAAC_X4_LANES,
+               "ISAAC_X4_LANES must match its base 2 logarithm.");
+#define LANES_X8_LOG2 3U
+_Static_assert((1U << LANES_X8_LOG2) == ISAAC_X8_LANES,
+               "ISAAC_X8_LANES must match its base 2 logarithm.");
+
+void isaac_x4_init(isaac_x4_ctx_t* const ctx,
+                   const uint8_t* const seeds[ISAAC_X4_LANES],
+                   const uint16_t seed_bytes[ISAAC_X4_LANES])
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+    lanes_init(ctx->mem, ctx->result, ctx->a, ctx->b, ctx->c,
+               &ctx->stream_index, LANES_X4_LOG2, seeds, seed_bytes);
+}
+
+void isaac_x4_stream(isaac_x4_ctx_t* const ctx,
+                     isaac_uint_t* const ints[ISAAC_X4_LANES],
+                     const size_t amount)
+{
+    if (ctx == NULL || ints == NULL)
+    {
+        return;
+    }
+    lanes_stream(ctx->mem, ctx->result, ctx->a, ctx->b, ctx->c,
+                 &ctx->stream_index, LANES_X4_LOG2, ints, amount);
+}
+
+void isaac_x4_cleanup(isaac_x4_ctx_t* const ctx)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+    lanes_cleanup((isaac_uint_t*) ctx, sizeof(*ctx) / sizeof(isaac_uint_t));
+}
+
+void isaac_x8_init(isaac_x8_ctx_t* const ctx,
+                   const uint8_t* const seeds[ISAAC_X8_LANES],
+                   const uint16_t seed_bytes[ISAAC_X8_LANES])
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+    lanes_init(ctx->mem, ctx->result, ctx->a, ctx->b, ctx->c,
+               &ctx->stream_index, LANES_X8_LOG2, seeds, seed_bytes);
+}
+
+void isaac_x8_stream(isaac_x8_ctx_t* const ctx,
+                     isaac_uint_t* const ints[ISAAC_X8_LANES],
+                     const size_t amount)
+{
+    if (ctx == NULL || ints == NULL)
+    {
+        return;
+    }
+    lanes_stream(ctx->mem, ctx->result, ctx->a, ctx->b, ctx->c,
+                 &ctx->stream_index, LANES_X8_LOG2, ints, amount);
+}
+
+void isaac_x8_cleanup(isaac_x8_ctx_t* const ctx)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+    lanes_cleanup((isaac_uint_t*) ctx, sizeof(*ctx) / sizeof(isaac_uint_t));
+}
+
+#if ISAAC_KERNEL_X86
+/**
+ * @internal
+ * Runs both initialisation passes of isaac_init() over the #ISAAC_X8_LANES
+ * lanes of an interleaved state with the widest vector kernel selected at
+ * runtime, AVX2 at least.
+ */
+static void lanes_init_passes(isaac_uint_t* const mem,
+                              const isaac_uint_t* const seeds)
+{
+    isaac_uint_t golden[8];
+    uint_fast16_t i;
+    for (i = 0; i < 8; i++)
+    {
+        golden[i] = GOLDEN_RATIO;
+    }
+    /* The scrambled golden ratio does not depend on the seed. */
+    for (i = 0; i < 4; i++)
+    {
+        ISAAC_MIX(golden[0], golden[1], golden[2], golden[3],
+                  golden[4], golden[5], golden[6], golden[7]);
+    }
+#if ISAAC_BITS > 32
+    if (isaac_kernel() == ISAAC_KERNEL_AVX512)
+    {
+        lanes_init_passes_avx512(mem, seeds, golden);
+        return;
+    }
+    lanes_init_passes_avx2(mem, seeds, golden);
+#else
+    lanes_init_passes_avx2_wide(mem, seeds, golden);
+#endif
+}
+
+/**
+ * @internal
+ * Initialises #ISAAC_X8_LANES contexts at once, as many isaac_init() calls
+ * would: the seeds are interleaved, mixed and shuffled as lanes of a
+ * #isaac_x8_ctx_t, then every lane is copied into its context.
+ */
+static void lanes_init_group(isaac_x8_ctx_t* const lanes,
+                             isaac_ctx_t* const ctxs,
+                             const uint8_t* const* const seeds,
+                             const uint16_t* const seed_bytes)
+{
+    uint_fast16_t lane;
+    uint_fast16_t i;
+    for (lane = 0; lane < ISAAC_X8_LANES; lane++)
+    {
+        /* Copied value-wise and zero-padded, as isaac_init() does. */
+        const uint8_t* const seed = seeds == NULL ? NULL : seeds[lane];
+        uint_fast16_t bytes = 0;
+        if (seed != NULL && seed_bytes != NULL)
+        {
+            bytes = ISAAC_MIN(seed_bytes[lane], ISAAC_SEED_MAX_BYTES);
+        }
+        for (i = 0; i < bytes; i++)
+        {
+            lanes->result[LANES_AT(i, LANES_X8_LOG2) + lane] = seed[i];
+        }
+        for (; i < ISAAC_ELEMENTS; i++)
+        {
+            lanes->result[LANES_AT(i, LANES_X8_LOG2) + lane] = 0;
+        }
+        lanes->a[lane] = lanes->b[lane] = lanes->c[lane] = 0;
+    }
+    lanes_init_passes(lanes->mem, lanes->result);
+    lanes_shuffle(lanes->mem, lanes->result, lanes->a, lanes->b, lanes->c,
+                  LANES_X8_LOG2);
+    /* Reading the interleaved state in order, writing 8 sequential streams. */
+    for (i = 0; i < ISAAC_ELEMENTS; i++)
+    {
+        for (lane = 0; lane < ISAAC_X8_LANES; lane++)
+        {
+            ctxs[lane].result[i] =
+                    lanes->result[LANES_AT(i, LANES_X8_LOG2) + lane];
+            ctxs[lane].mem[i] = lanes->mem[LANES_AT(i, LANES_X8_LOG2) + lane];
+        }
+    }
+    for (lane = 0; lane < ISAAC_X8_LANES; lane++)
+    {
+        isaac_ctx_t* const ctx = &ctxs[lane];
+        ctx->a = lanes->a[lane];
+        ctx->b = lanes->b[lane];
+        ctx->c = lanes->c[lane];
+        ctx->stream_index = 0;
+        ctx->stream_byte = ctx->stream_byte_order = 0;
+#if ISAAC_CTX_ALIGNED
+        memset(ctx->padding, 0, sizeof(ctx->padding));
+#endif
+    }
+}
+#endif
+
+void isaac_init_many(isaac_ctx_t* const ctxs,
+                     const uint8_t* const* const seeds,
+                     const uint16_t* const seed_bytes,
+                     const size_t count)
+{
+    if (ctxs == NULL || count == 0)
+    {
+        return;
+    }
+    size_t done = 0;
+#if ISAAC_KERNEL_X86
+    /* Without gathers, interleaving the lanes costs more than it saves. */
+    const isaac_kernel_t kernel = isaac_kernel();
+    if (count >= ISAAC_X8_LANES
+        && (kernel == ISAAC_KERNEL_AVX2 || kernel == ISAAC_KERNEL_AVX512))
+    {
+        isaac_x8_ctx_t lanes;
+        for (; count - done >= ISAAC_X8_LANES; done += ISAAC_X8_LANES)
+        {
+            lanes_init_group(&lanes, &ctxs[done],
+                             seeds == NULL ? NULL : &seeds[done],
+                             seed_bytes == NULL ? NULL : &seed_bytes[done]);
+        }
+        isaac_x8_cleanup(&lanes);
+    }
+#endif
+    for (; done < count; done++)
+    {
+        isaac_init(&ctxs[done],
+                   seeds == NULL ? NULL : seeds[done],
+                   seed_bytes == NULL ? 0U : seed_bytes[done]);
+    }
+}
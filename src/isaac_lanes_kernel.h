@@ -0,0 +1,162 @@
+/**
+ * @file
+ *
+ * LibISAAC multi-lane vector kernel template.
+ *
+ * Not a regular header: it is included by isaac_lanes.c once per vector
+ * instruction set, each time defining a reshuffling kernel and optionally an
+ * initialisation kernel processing #LANES_KERNEL_WIDTH adjacent lanes per
+ * vector. Before inclusion define:
+ * - `LANES_KERNEL_NAME`: name of the generated reshuffling function
+ * - `LANES_KERNEL_INIT_NAME`: name of the generated initialisation function,
+ *   not generated when undefined
+ * - `LANES_KERNEL_TARGET`: attribute enabling the instruction set
+ * - `LANES_KERNEL_WIDTH`: lanes per vector
+ * - `LANES_KERNEL_VEC`: vector type holding `LANES_KERNEL_WIDTH` words
+ * - `LANES_KERNEL_GATHER(base, idx)`: gathers the words at the indices `idx`
+ *   from the array `base`
+ *
+ * All of them are undefined at the end of the inclusion.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+/**
+ * @internal
+ * Permutes all lanes of an interleaved ISAAC state, #LANES_KERNEL_WIDTH lanes
+ * per vector. The amount of lanes must be a multiple of #LANES_KERNEL_WIDTH.
+ *
+ * @param mem interleaved ISAAC internal state of all lanes
+ * @param result interleaved output of all lanes
+ * @param la `a` values of all lanes
+ * @param lb `b` values of all lanes
+ * @param lc `c` values of all lanes
+ * @param log2 base 2 logarithm of the amount of lanes
+ */
+LANES_KERNEL_TARGET
+static void LANES_KERNEL_NAME(isaac_uint_t* const mem,
+                              isaac_uint_t* const result,
+                              isaac_uint_t* const la,
+                              isaac_uint_t* const lb,
+                              isaac_uint_t* const lc,
+                              const unsigned int log2)
+{
+    const uint_fast16_t groups = (1U << log2) / LANES_KERNEL_WIDTH;
+    LANES_KERNEL_VEC a[ISAAC_X8_LANES / LANES_KERNEL_WIDTH];
+    LANES_KERNEL_VEC b[ISAAC_X8_LANES / LANES_KERNEL_WIDTH];
+    LANES_KERNEL_VEC c;
+    LANES_KERNEL_VEC iota;
+    LANES_KERNEL_VEC x;
+    LANES_KERNEL_VEC y;
+    uint_fast16_t g;
+    uint_fast16_t i;
+    memset(a, 0, sizeof(a));
+    memset(b, 0, sizeof(b));
+    for (i = 0; i < LANES_KERNEL_WIDTH; i++)
+    {
+        iota[i] = (isaac_uint_t) i;
+    }
+    for (g = 0; g < groups; g++)
+    {
+        memcpy(&a[g], la + g * LANES_KERNEL_WIDTH, sizeof(a[g]));
+        memcpy(&b[g], lb + g * LANES_KERNEL_WIDTH, sizeof(b[g]));
+        memcpy(&c, lc + g * LANES_KERNEL_WIDTH, sizeof(c));
+        c += 1U;
+        b[g] += c;
+        memcpy(lc + g * LANES_KERNEL_WIDTH, &c, sizeof(c));
+    }
+    for (i = 0; i < ISAAC_ELEMENTS; i += 4)
+    {
+        /* Steps of different groups are independent: interleaving them hides
+         * the latency of the gathers. */
+        for (g = 0; g < groups; g++)
+        {
+            isaac_uint_t* const mg = mem + g * LANES_KERNEL_WIDTH;
+            isaac_uint_t* const rg = result + g * LANES_KERNEL_WIDTH;
+            LANES_VSTEP(LANES_MIX_0(a[g]), a[g], b[g], mg, rg, i + 0U, log2,
+                        iota, x, y);
+            LANES_VSTEP(LANES_MIX_1(a[g]), a[g], b[g], mg, rg, i + 1U, log2,
+                        iota, x, y);
+            LANES_VSTEP(LANES_MIX_2(a[g]), a[g], b[g], mg, rg, i + 2U, log2,
+                        iota, x, y);
+            LANES_VSTEP(LANES_MIX_3(a[g]), a[g], b[g], mg, rg, i + 3U, log2,
+                        iota, x, y);
+        }
+    }
+    for (g = 0; g < groups; g++)
+    {
+        memcpy(la + g * LANES_KERNEL_WIDTH, &a[g], sizeof(a[g]));
+        memcpy(lb + g * LANES_KERNEL_WIDTH, &b[g], sizeof(b[g]));
+    }
+}
+
+#ifdef LANES_KERNEL_INIT_NAME
+/**
+ * @internal
+ * Runs both initialisation passes of isaac_init() over the #ISAAC_X8_LANES
+ * lanes of an interleaved state, #LANES_KERNEL_WIDTH lanes per vector.
+ *
+ * The mixing function has no lookups, so unlike the reshuffle it needs no
+ * gathers: each step of the scalar version is one vector instruction.
+ *
+ * @param mem interleaved ISAAC internal state of all lanes
+ * @param seeds interleaved seeds of all lanes, as isaac_init() places them
+ * into `result`
+ * @param golden mixing registers before the first pass, the same for all
+ * lanes
+ */
+LANES_KERNEL_TARGET
+static void LANES_KERNEL_INIT_NAME(isaac_uint_t* const mem,
+                                   const isaac_uint_t* const seeds,
+                                   const isaac_uint_t golden[8])
+{
+    LANES_KERNEL_VEC r[8][ISAAC_X8_LANES / LANES_KERNEL_WIDTH];
+    LANES_KERNEL_VEC x;
+    const isaac_uint_t* src = seeds;
+    uint_fast16_t pass;
+    uint_fast16_t g;
+    uint_fast16_t k;
+    uint_fast16_t i;
+    for (k = 0; k < 8; k++)
+    {
+        for (g = 0; g < ISAAC_X8_LANES / LANES_KERNEL_WIDTH; g++)
+        {
+            for (i = 0; i < LANES_KERNEL_WIDTH; i++)
+            {
+                r[k][g][i] = golden[k];
+            }
+        }
+    }
+    for (pass = 0; pass < 2; pass++, src = mem)
+    {
+        for (i = 0; i < ISAAC_ELEMENTS; i += 8)
+        {
+            for (g = 0; g < ISAAC_X8_LANES / LANES_KERNEL_WIDTH; g++)
+            {
+                const uint_fast16_t at =
+                        i * ISAAC_X8_LANES + g * LANES_KERNEL_WIDTH;
+                for (k = 0; k < 8; k++)
+                {
+                    memcpy(&x, &src[at + k * ISAAC_X8_LANES], sizeof(x));
+                    r[k][g] += x;
+                }
+                ISAAC_MIX(r[0][g], r[1][g], r[2][g], r[3][g],
+                          r[4][g], r[5][g], r[6][g], r[7][g]);
+                for (k = 0; k < 8; k++)
+                {
+                    memcpy(&mem[at + k * ISAAC_X8_LANES], &r[k][g], sizeof(x));
+                }
+            }
+        }
+    }
+}
+#endif
+
+#undef LANES_KERNEL_NAME
+#undef LANES_KERNEL_INIT_NAME
+#undef LANES_KERNEL_TARGET
+#undef LANES_KERNEL_WIDTH
+#undef LANES_KERNEL_VEC
+#undef LANES_KERNEL_GATHER
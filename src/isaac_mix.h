@@ -0,0 +1,57 @@
+/**
+ * @file
+ *
+ * LibISAAC internal header: mixing function of the initialisation.
+ *
+ * Shared by isaac_init() and the functions deriving the state in a similar
+ * way, such as the batched initialisation of many contexts.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#ifndef ISAAC_MIX_H
+#define ISAAC_MIX_H
+
+#include "isaac.h"
+
+#if ISAAC_BITS > 32
+#define ISAAC_MIX(a, b, c, d, e, f, g, h) \
+{ \
+   a -= e; f ^= h >> 9U;  h += a; \
+   b -= f; g ^= a << 9U;  a += b; \
+   c -= g; h ^= b >> 23U; b += c; \
+   d -= h; a ^= c << 15U; c += d; \
+   e -= a; b ^= d >> 14U; d += e; \
+   f -= b; c ^= e << 20U; e += f; \
+   g -= c; d ^= f >> 17U; f += g; \
+   h -= d; e ^= g << 14U; g += h; \
+}
+
+/* Explanations why it does not look like 1.618033988749894848...:
+ * https://stackoverflow.com/a/4948967
+ * https://softwareengineering.stackexchange.com/a/63605
+ */
+#define GOLDEN_RATIO 0x9e3779b97f4a7c13LL
+#else
+#define ISAAC_MIX(a, b, c, d, e, f, g, h) \
+{ \
+   a ^= b << 11U; d += a; b += c; \
+   b ^= c >> 2U;  e += b; c += d; \
+   c ^= d << 8U;  f += c; d += e; \
+   d ^= e >> 16U; g += d; e += f; \
+   e ^= f << 10U; h += e; f += g; \
+   f ^= g >> 4U;  a += f; g += h; \
+   g ^= h << 8U;  b += g; h += a; \
+   h ^= a >> 9U;  c += h; a += b; \
+}
+
+/* Explanations why it does not look like 1.618033988749894848...:
+ * https://stackoverflow.com/a/4948967
+ * https://softwareengineering.stackexchange.com/a/63605
+ */
+#define GOLDEN_RATIO 0x9e3779b9L
+#endif
+
+#endif  /* ISAAC_MIX_H */
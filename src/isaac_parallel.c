@@ -0,0 +1,152 @@
+/**
+ * @file
+ *
+ * LibISAAC parallel generation: filling large buffers with many threads,
+ * reproducibly.
+ *
+ * The buffer is split into chunks of #ISAAC_FILL_CHUNK_WORDS integers, each
+ * generated by its own ISAAC state, seeded with the master seed and the
+ * index of the chunk. The threads take the next chunk not taken yet from a
+ * shared counter until none is left, so the output does not depend on which
+ * thread generates which chunk.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "isaac.h"
+#include <string.h>
+
+#if ISAAC_THREADS
+#include <pthread.h>
+#include <stdatomic.h>
+#endif
+
+/* Bytes of the seed of a chunk holding its index. */
+#define FILL_INDEX_BYTES 8U
+/* Bytes of the seed of a chunk holding the master seed. */
+#define FILL_MASTER_BYTES (ISAAC_SEED_MAX_BYTES - FILL_INDEX_BYTES)
+
+/**
+ * @internal
+ * Work shared by the threads of one isaac_fill_parallel() call.
+ */
+typedef struct
+{
+    /** Master seed, zero-padded, followed by room for the chunk index. */
+    uint8_t seed[ISAAC_SEED_MAX_BYTES];
+    /** Buffer to fill. */
+    isaac_uint_t* out;
+    /** Length of the buffer in integers. */
+    size_t words;
+    /** Amount of chunks in the buffer, the last one possibly shorter. */
+    size_t chunks;
+#if ISAAC_THREADS
+    /** Index of the next chunk not taken by any thread yet. */
+    atomic_size_t next_chunk;
+#endif
+} fill_job_t;
+
+/**
+ * @internal
+ * Generates one chunk of the buffer with its own ISAAC state.
+ */
+static void fill_chunk(const fill_job_t* const job, const size_t chunk)
+{
+    uint8_t seed[ISAAC_SEED_MAX_BYTES];
+    isaac_ctx_t ctx;
+    memcpy(seed, job->seed, FILL_MASTER_BYTES);
+    for (uint_fast8_t i = 0; i < FILL_INDEX_BYTES; i++)
+    {
+        /* Little endian, whatever the host byte order. */
+        seed[FILL_MASTER_BYTES + i] = (uint8_t) ((uint64_t) chunk >> (8U * i));
+    }
+    isaac_init(&ctx, seed, ISAAC_SEED_MAX_BYTES);
+    const size_t first = chunk * ISAAC_FILL_CHUNK_WORDS;
+    size_t amount = job->words - first;
+    if (amount > ISAAC_FILL_CHUNK_WORDS)
+    {
+        amount = ISAAC_FILL_CHUNK_WORDS;
+    }
+    isaac_stream(&ctx, &job->out[first], amount);
+    isaac_cleanup(&ctx);
+    memset(seed, 0, sizeof(seed));
+}
+
+#if ISAAC_THREADS
+/**
+ * @internal
+ * Generates chunks until none is left. Entry point of the worker threads.
+ */
+static void* fill_worker(void* const arg)
+{
+    fill_job_t* const job = arg;
+    for (;;)
+    {
+        const size_t chunk = atomic_fetch_add_explicit(
+                &job->next_chunk, 1U, memory_order_relaxed);
+        if (chunk >= job->chunks)
+        {
+            return NULL;
+        }
+        fill_chunk(job, chunk);
+    }
+}
+#endif
+
+void isaac_fill_parallel(const uint8_t* const master_seed,
+                         uint16_t seed_bytes,
+                         isaac_uint_t* const out,
+                         const size_t words,
+                         size_t threads)
+{
+    if (out == NULL || words == 0)
+    {
+        return;
+    }
+    fill_job_t job;
+    memset(job.seed, 0, sizeof(job.seed));
+    if (master_seed != NULL)
+    {
+        if (seed_bytes > FILL_MASTER_BYTES)
+        {
+            seed_bytes = FILL_MASTER_BYTES;
+        }
+        memcpy(job.seed, master_seed, seed_bytes);
+    }
+    job.out = out;
+    job.words = words;
+    job.chunks = (words - 1U) / ISAAC_FILL_CHUNK_WORDS + 1U;
+#if ISAAC_THREADS
+    atomic_init(&job.next_chunk, 0);
+    if (threads > job.chunks)
+    {
+        threads = job.chunks;
+    }
+    if (threads > ISAAC_FILL_MAX_THREADS)
+    {
+        threads = ISAAC_FILL_MAX_THREADS;
+    }
+    /* The calling thread is one of the workers. */
+    pthread_t helpers[ISAAC_FILL_MAX_THREADS];
+    size_t started = 0;
+    while (started + 1U < threads
+           && pthread_create(&helpers[started], NULL, fill_worker, &job) == 0)
+    {
+        started++;
+    }
+    fill_worker(&job);
+    for (size_t i = 0; i < started; i++)
+    {
+        pthread_join(helpers[i], NULL);
+    }
+#else
+    (void) threads;
+    for (size_t chunk = 0; chunk < job.chunks; chunk++)
+    {
+        fill_chunk(&job, chunk);
+    }
+#endif
+    memset(job.seed, 0, sizeof(job.seed));
+}
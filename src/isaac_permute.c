@@ -0,0 +1,228 @@
+/**
+ * @file
+ *
+ * LibISAAC permutations: shuffling arrays and generating random orderings,
+ * with the Fisher-Yates algorithm and unbiased bounded integers.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "isaac.h"
+#include "isaac_draw.h"
+#include <string.h>
+
+/* Arrays larger than this likely exceed the last level cache: their
+ * accesses at random positions are prefetched. */
+#define PERMUTE_PREFETCH_BYTES (4U * 1024U * 1024U)
+/* How many positions ahead are drawn and prefetched. */
+#define PERMUTE_PREFETCH_DISTANCE 16U
+/* Bytes swapped at the time by swap_elements(). */
+#define PERMUTE_SWAP_CHUNK 64U
+
+#if defined(__GNUC__) || defined(__clang__)
+#define PERMUTE_PREFETCH(address) __builtin_prefetch((address), 1)
+#else
+#define PERMUTE_PREFETCH(address) ((void) (address))
+#endif
+
+#define PERMUTE_MIN(a, b) (((a) < (b)) ? (a) : (b))
+
+/**
+ * @internal
+ * Swaps two elements of the given size, with fixed-size copies for the most
+ * common sizes.
+ */
+static inline void swap_elements(uint8_t* const a,
+                                 uint8_t* const b,
+                                 const size_t size)
+{
+    switch (size)
+    {
+        case sizeof(uint32_t):
+        {
+            uint32_t x;
+            uint32_t y;
+            memcpy(&x, a, sizeof(x));
+            memcpy(&y, b, sizeof(y));
+            memcpy(a, &y, sizeof(y));
+            memcpy(b, &x, sizeof(x));
+            break;
+        }
+        case sizeof(uint64_t):
+        {
+            uint64_t x;
+            uint64_t y;
+            memcpy(&x, a, sizeof(x));
+            memcpy(&y, b, sizeof(y));
+            memcpy(a, &y, sizeof(y));
+            memcpy(b, &x, sizeof(x));
+            break;
+        }
+        default:
+        {
+            uint8_t tmp[PERMUTE_SWAP_CHUNK];
+            size_t done = 0;
+            while (done < size)
+            {
+                const size_t chunk = PERMUTE_MIN(size - done,
+                                                 PERMUTE_SWAP_CHUNK);
+                memcpy(tmp, a + done, chunk);
+                memmove(a + done, b + done, chunk);
+                memcpy(b + done, tmp, chunk);
+                done += chunk;
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * @internal
+ * Fisher-Yates shuffle, swapping each element from the last one with an
+ * element at a random position before it.
+ */
+static void shuffle(isaac_draw_t* const draw,
+                    uint8_t* const base,
+                    const size_t count,
+                    const size_t size)
+{
+    for (size_t i = count - 1U; i > 0; i--)
+    {
+        const size_t j = draw_index(draw, i + 1U);
+        swap_elements(base + i * size, base + j * size, size);
+    }
+}
+
+/**
+ * @internal
+ * Same as shuffle(), for arrays larger than the cache.
+ *
+ * The random positions are drawn #PERMUTE_PREFETCH_DISTANCE steps in
+ * advance and their elements prefetched, so the swaps find them in the
+ * cache instead of waiting for the memory. The draws are the same, in the
+ * same order, so the result equals the one of shuffle().
+ */
+static void shuffle_prefetching(isaac_draw_t* const draw,
+                                uint8_t* const base,
+                                const size_t count,
+                                const size_t size)
+{
+    size_t ahead[PERMUTE_PREFETCH_DISTANCE];
+    uint_fast8_t slot;
+    for (slot = 0; slot < PERMUTE_PREFETCH_DISTANCE
+                   && slot < count - 1U; slot++)
+    {
+        ahead[slot] = draw_index(draw, count - slot);
+        PERMUTE_PREFETCH(base + ahead[slot] * size);
+    }
+    slot = 0;
+    for (size_t i = count - 1U; i > 0; i--)
+    {
+        const size_t j = ahead[slot];
+        if (i > PERMUTE_PREFETCH_DISTANCE)
+        {
+            /* Position of the swap of the element i - distance. */
+            ahead[slot] = draw_index(draw, i - PERMUTE_PREFETCH_DISTANCE + 1U);
+            PERMUTE_PREFETCH(base + ahead[slot] * size);
+        }
+        slot = (uint_fast8_t) ((slot + 1U) % PERMUTE_PREFETCH_DISTANCE);
+        swap_elements(base + i * size, base + j * size, size);
+    }
+}
+
+void isaac_shuffle_array(isaac_ctx_t* const ctx,
+                         void* const base,
+                         const size_t count,
+                         const size_t elem_size)
+{
+    if (ctx == NULL || base == NULL || count < 2U || elem_size == 0)
+    {
+        return;
+    }
+    isaac_draw_t draw;
+    draw_begin(&draw, ctx);
+    if (count > PERMUTE_PREFETCH_BYTES / elem_size)
+    {
+        shuffle_prefetching(&draw, base, count, elem_size);
+    }
+    else
+    {
+        shuffle(&draw, base, count, elem_size);
+    }
+    draw_end(&draw);
+}
+
+/**
+ * @internal
+ * "Inside-out" Fisher-Yates: each value i is placed at a random position
+ * among the first i + 1, moving the value there to the end.
+ */
+static void permutation(isaac_draw_t* const draw,
+                        uint32_t* const out,
+                        const uint32_t n)
+{
+    out[0] = 0;
+    for (uint32_t i = 1; i < n; i++)
+    {
+        const uint32_t j = draw_bounded_u32(draw, i + 1U);
+        /* When j == i, out[i] is not written yet. */
+        out[i] = (j == i) ? i : out[j];
+        out[j] = i;
+    }
+}
+
+/**
+ * @internal
+ * Same as permutation(), prefetching as shuffle_prefetching() does.
+ */
+static void permutation_prefetching(isaac_draw_t* const draw,
+                                    uint32_t* const out,
+                                    const uint32_t n)
+{
+    uint32_t ahead[PERMUTE_PREFETCH_DISTANCE];
+    uint_fast8_t slot;
+    for (slot = 0; slot < PERMUTE_PREFETCH_DISTANCE && slot < n - 1U; slot++)
+    {
+        ahead[slot] = draw_bounded_u32(draw, slot + 2U);
+        PERMUTE_PREFETCH(&out[ahead[slot]]);
+    }
+    slot = 0;
+    out[0] = 0;
+    for (uint32_t i = 1; i < n; i++)
+    {
+        const uint32_t j = ahead[slot];
+        if (i < n - PERMUTE_PREFETCH_DISTANCE)
+        {
+            /* Position of the value i + distance. */
+            ahead[slot] = draw_bounded_u32(
+                    draw, i + PERMUTE_PREFETCH_DISTANCE + 1U);
+            PERMUTE_PREFETCH(&out[ahead[slot]]);
+        }
+        slot = (uint_fast8_t) ((slot + 1U) % PERMUTE_PREFETCH_DISTANCE);
+        out[i] = (j == i) ? i : out[j];
+        out[j] = i;
+    }
+}
+
+void isaac_permutation_u32(isaac_ctx_t* const ctx,
+                           uint32_t* const out,
+                           const uint32_t n)
+{
+    if (ctx == NULL || out == NULL || n == 0)
+    {
+        return;
+    }
+    isaac_draw_t draw;
+    draw_begin(&draw, ctx);
+    if (n > PERMUTE_PREFETCH_BYTES / sizeof(uint32_t))
+    {
+        permutation_prefetching(&draw, out, n);
+    }
+    else
+    {
+        permutation(&draw, out, n);
+    }
+    draw_end(&draw);
+}
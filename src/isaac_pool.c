@@ -0,0 +1,298 @@
+/**
+ * @file
+ *
+ * LibISAAC pool of contexts, carved out of huge-page slabs.
+ *
+ * Each slab is a region of #ISAAC_POOL_SLAB_BYTES bytes aligned to its size,
+ * so the kernel can back it with a single transparent huge page. It starts
+ * with a header of one cache line, linking the slabs in order of mapping,
+ * followed by the contexts, each on its own cache lines.
+ *
+ * The contexts are carved from the slabs in order, and only once: the
+ * released ones go into a free list threaded through the contexts themselves
+ * and are reused first, most recently released first, while their memory is
+ * still in the cache. The slabs are mapped only when needed, so an untouched
+ * part of a slab costs no page faults.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+/* mmap() with MAP_ANONYMOUS and madvise() are not part of ISO C. */
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif
+
+#include "isaac.h"
+#include "isaac_alloc.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define POOL_MMAP 1
+#include <sys/mman.h>
+#else
+#define POOL_MMAP 0
+#endif
+
+/* Distance between the contexts in a slab, keeping them aligned. */
+#define POOL_STRIDE ((sizeof(isaac_ctx_t) + ISAAC_CACHE_LINE - 1U) \
+                     / ISAAC_CACHE_LINE * ISAAC_CACHE_LINE)
+/* Amount of contexts in a slab, after the header. */
+#define POOL_SLAB_CONTEXTS ((ISAAC_POOL_SLAB_BYTES - ISAAC_CACHE_LINE) \
+                            / POOL_STRIDE)
+
+/**
+ * @internal
+ * Header of a slab, in its first cache line.
+ */
+typedef struct pool_slab_s
+{
+    /** The slab mapped after this one. */
+    struct pool_slab_s* next;
+} pool_slab_t;
+
+/**
+ * @internal
+ * Released context, linked into the free list.
+ */
+typedef struct pool_free_s
+{
+    /** The context released before this one. */
+    struct pool_free_s* next;
+} pool_free_t;
+
+struct isaac_pool_s
+{
+    /** The slabs, in order of mapping. */
+    pool_slab_t* first;
+    /** The slab contexts are being carved from. Those after it are unused. */
+    pool_slab_t* current;
+    /** Amount of contexts carved from the current slab. */
+    size_t carved;
+    /** Released contexts, most recently released first. */
+    pool_free_t* released;
+    /** Contexts acquired and not released yet. */
+    size_t in_use;
+    /** Combination of #isaac_pool_flags_t. */
+    unsigned int flags;
+};
+
+_Static_assert(POOL_SLAB_CONTEXTS > 0,
+               "A slab must hold at least one ISAAC context.");
+
+/**
+ * @internal
+ * Context at a position of the slab.
+ */
+static inline isaac_ctx_t* pool_context(pool_slab_t* const slab,
+                                        const size_t position)
+{
+    return (isaac_ctx_t*) ((uint8_t*) slab + ISAAC_CACHE_LINE
+                           + position * POOL_STRIDE);
+}
+
+/**
+ * @internal
+ * Releases the memory of a slab.
+ */
+static void pool_unmap_slab(pool_slab_t* const slab)
+{
+#if POOL_MMAP
+    munmap(slab, ISAAC_POOL_SLAB_BYTES);
+#else
+    alloc_aligned_free(slab);
+#endif
+}
+
+/**
+ * @internal
+ * Maps a slab aligned to its size, applying the flags of the pool.
+ *
+ * @return the slab, or NULL when it could not be mapped or the flags could
+ * not be applied.
+ */
+static pool_slab_t* pool_map_slab(const unsigned int flags)
+{
+    pool_slab_t* slab;
+#if POOL_MMAP
+    /* Twice the size, trimmed to the part aligned to the size. */
+    uint8_t* const region = mmap(NULL, 2U * ISAAC_POOL_SLAB_BYTES,
+                                 PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (region == MAP_FAILED)
+    {
+        return NULL;
+    }
+    const size_t head = (ISAAC_POOL_SLAB_BYTES
+                         - (uintptr_t) region % ISAAC_POOL_SLAB_BYTES)
+                        % ISAAC_POOL_SLAB_BYTES;
+    if (head > 0)
+    {
+        munmap(region, head);
+    }
+    munmap(region + head + ISAAC_POOL_SLAB_BYTES,
+           ISAAC_POOL_SLAB_BYTES - head);
+    slab = (pool_slab_t*) (region + head);
+#ifdef MADV_HUGEPAGE
+    /* Only a hint: without huge pages the slab still works. */
+    madvise(slab, ISAAC_POOL_SLAB_BYTES, MADV_HUGEPAGE);
+#endif
+    if (flags & ISAAC_POOL_NO_DUMP)
+    {
+#ifdef MADV_DONTDUMP
+        if (madvise(slab, ISAAC_POOL_SLAB_BYTES, MADV_DONTDUMP) != 0)
+        {
+            pool_unmap_slab(slab);
+            return NULL;
+        }
+#else
+        pool_unmap_slab(slab);
+        return NULL;
+#endif
+    }
+    if ((flags & ISAAC_POOL_LOCKED)
+        && mlock(slab, ISAAC_POOL_SLAB_BYTES) != 0)
+    {
+        pool_unmap_slab(slab);
+        return NULL;
+    }
+#else
+    if (flags != ISAAC_POOL_DEFAULT)
+    {
+        return NULL;
+    }
+    slab = alloc_aligned(ISAAC_CACHE_LINE, ISAAC_POOL_SLAB_BYTES);
+    if (slab == NULL)
+    {
+        return NULL;
+    }
+#endif
+    slab->next = NULL;
+    return slab;
+}
+
+/**
+ * @internal
+ * Safely erases all the contexts carved so far, slab by slab.
+ */
+static void pool_erase(isaac_pool_t* const pool)
+{
+    pool_slab_t* slab = pool->first;
+    while (slab != pool->current)
+    {
+        memset(pool_context(slab, 0), 0, POOL_SLAB_CONTEXTS * POOL_STRIDE);
+        slab = slab->next;
+    }
+    memset(pool_context(slab, 0), 0, pool->carved * POOL_STRIDE);
+}
+
+isaac_pool_t* isaac_pool_new(const unsigned int flags)
+{
+    isaac_pool_t* const pool = malloc(sizeof(isaac_pool_t));
+    if (pool == NULL)
+    {
+        return NULL;
+    }
+    pool->first = pool_map_slab(flags);
+    if (pool->first == NULL)
+    {
+        free(pool);
+        return NULL;
+    }
+    pool->current = pool->first;
+    pool->carved = 0;
+    pool->released = NULL;
+    pool->in_use = 0;
+    pool->flags = flags;
+    return pool;
+}
+
+isaac_ctx_t* isaac_pool_acquire(isaac_pool_t* const pool,
+                                const uint8_t* const seed,
+                                const uint16_t seed_bytes)
+{
+    if (pool == NULL)
+    {
+        return NULL;
+    }
+    isaac_ctx_t* ctx;
+    if (pool->released != NULL)
+    {
+        ctx = (isaac_ctx_t*) pool->released;
+        pool->released = pool->released->next;
+    }
+    else
+    {
+        if (pool->carved == POOL_SLAB_CONTEXTS)
+        {
+            if (pool->current->next == NULL)
+            {
+                pool->current->next = pool_map_slab(pool->flags);
+                if (pool->current->next == NULL)
+                {
+                    return NULL;
+                }
+            }
+            pool->current = pool->current->next;
+            pool->carved = 0;
+        }
+        ctx = pool_context(pool->current, pool->carved++);
+    }
+    pool->in_use++;
+    isaac_init(ctx, seed, seed_bytes);
+    return ctx;
+}
+
+void isaac_pool_release(isaac_pool_t* const pool, isaac_ctx_t* const ctx)
+{
+    if (pool == NULL || ctx == NULL)
+    {
+        return;
+    }
+    isaac_cleanup(ctx);
+    pool_free_t* const released = (pool_free_t*) ctx;
+    released->next = pool->released;
+    pool->released = released;
+    pool->in_use--;
+}
+
+size_t isaac_pool_in_use(const isaac_pool_t* const pool)
+{
+    if (pool == NULL)
+    {
+        return 0;
+    }
+    return pool->in_use;
+}
+
+void isaac_pool_reset(isaac_pool_t* const pool)
+{
+    if (pool == NULL)
+    {
+        return;
+    }
+    pool_erase(pool);
+    pool->current = pool->first;
+    pool->carved = 0;
+    pool->released = NULL;
+    pool->in_use = 0;
+}
+
+void isaac_pool_free(isaac_pool_t* const pool)
+{
+    if (pool == NULL)
+    {
+        return;
+    }
+    pool_erase(pool);
+    pool_slab_t* slab = pool->first;
+    while (slab != NULL)
+    {
+        pool_slab_t* const next = slab->next;
+        pool_unmap_slab(slab);
+        slab = next;
+    }
+    free(pool);
+}
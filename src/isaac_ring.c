@@ -0,0 +1,376 @@
+/**
+ * @file
+ *
+ * LibISAAC ring buffer of pre-generated integers, filled by one producer
+ * thread and read by any amount of consumer threads without locks.
+ *
+ * The ring holds the stream of an ISAAC state, in batches of #ISAAC_ELEMENTS
+ * integers. `head` counts the integers ever published by the producer,
+ * `tail` the ones ever taken by the consumers; both only grow, each on its
+ * own cache line. A consumer copies the integers after `tail` and then
+ * claims them by advancing `tail` with a compare-and-swap: if another
+ * consumer was faster, the copy is discarded and retried. As `tail` only
+ * moves once the copy is done, the producer never overwrites integers that
+ * are still being read.
+ *
+ * The producer sleeps when the ring is filled to the high watermark and is
+ * woken by the consumer draining it to the low watermark. The mutex is only
+ * taken around the sleep and the wake-up, never by the reads.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "isaac.h"
+#include "isaac_alloc.h"
+#include <stdatomic.h>
+#include <stdalign.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if ISAAC_THREADS
+#include <pthread.h>
+#endif
+
+/* Size of a cache line on the common CPUs, separating the indices. */
+#define RING_CACHE_LINE 64U
+/* Integers converted at the time by isaac_ring_read_bytes(). */
+#define RING_BYTES_CHUNK 64U
+
+#define RING_MIN(a, b) (((a) < (b)) ? (a) : (b))
+
+struct isaac_ring_s
+{
+    /** Integers ever published. Written by the producer only. */
+    alignas(RING_CACHE_LINE) atomic_uint_fast64_t head;
+    /** Integers ever taken. Advanced by the consumers. */
+    alignas(RING_CACHE_LINE) atomic_uint_fast64_t tail;
+    /** True while the producer sleeps or is about to. */
+    alignas(RING_CACHE_LINE) atomic_bool sleeping;
+    /** The producer is woken when the ring has this many integers or less. */
+    atomic_size_t low;
+    /** The producer stops filling at this many integers. */
+    atomic_size_t high;
+    /** Capacity in integers, a power of 2, multiple of #ISAAC_ELEMENTS. */
+    size_t capacity;
+    /** Generates the batches. Used by the producer only. */
+    isaac_ctx_t ctx;
+#if ISAAC_THREADS
+    /** Guards the sleep of the producer. */
+    pthread_mutex_t lock;
+    /** Signalled to wake up the producer. */
+    pthread_cond_t wake;
+    /** Producer thread started by isaac_ring_start(). */
+    pthread_t thread;
+    /** True while the producer thread runs. */
+    bool running;
+    /** Asks the producer to return from isaac_ring_wait(). */
+    atomic_bool stop;
+#endif
+    /** The ring, of `capacity` integers. */
+    alignas(RING_CACHE_LINE) _Atomic isaac_uint_t words[];
+};
+
+/**
+ * @internal
+ * Amount of integers published and not taken yet.
+ */
+static inline size_t ring_level(isaac_ring_t* const ring)
+{
+    const uint_fast64_t tail = atomic_load(&ring->tail);
+    const uint_fast64_t head = atomic_load_explicit(&ring->head,
+                                                    memory_order_acquire);
+    return (size_t) (head - tail);
+}
+
+isaac_ring_t* isaac_ring_new(size_t batches,
+                             const uint8_t* const seed,
+                             const uint16_t seed_bytes)
+{
+    if (batches == 0 || batches > SIZE_MAX / 2U / ISAAC_ELEMENTS
+                                   / sizeof(isaac_uint_t))
+    {
+        return NULL;
+    }
+    size_t capacity = ISAAC_ELEMENTS;
+    while (capacity < batches * ISAAC_ELEMENTS)
+    {
+        capacity *= 2U;
+    }
+    isaac_ring_t* const ring = alloc_aligned(
+            RING_CACHE_LINE,
+            sizeof(isaac_ring_t) + capacity * sizeof(isaac_uint_t));
+    if (ring == NULL)
+    {
+        return NULL;
+    }
+#if ISAAC_THREADS
+    if (pthread_mutex_init(&ring->lock, NULL) != 0)
+    {
+        alloc_aligned_free(ring);
+        return NULL;
+    }
+    if (pthread_cond_init(&ring->wake, NULL) != 0)
+    {
+        pthread_mutex_destroy(&ring->lock);
+        alloc_aligned_free(ring);
+        return NULL;
+    }
+    ring->running = false;
+    atomic_init(&ring->stop, false);
+#endif
+    atomic_init(&ring->head, 0);
+    atomic_init(&ring->tail, 0);
+    atomic_init(&ring->sleeping, false);
+    atomic_init(&ring->low, capacity / 2U);
+    atomic_init(&ring->high, capacity);
+    ring->capacity = capacity;
+    isaac_init(&ring->ctx, seed, seed_bytes);
+    return ring;
+}
+
+void isaac_ring_free(isaac_ring_t* const ring)
+{
+    if (ring == NULL)
+    {
+        return;
+    }
+#if ISAAC_THREADS
+    if (ring->running)
+    {
+        atomic_store(&ring->stop, true);
+        pthread_mutex_lock(&ring->lock);
+        pthread_cond_signal(&ring->wake);
+        pthread_mutex_unlock(&ring->lock);
+        pthread_join(ring->thread, NULL);
+    }
+    pthread_cond_destroy(&ring->wake);
+    pthread_mutex_destroy(&ring->lock);
+#endif
+    isaac_cleanup(&ring->ctx);
+    for (size_t i = 0; i < ring->capacity; i++)
+    {
+        atomic_store_explicit(&ring->words[i], 0, memory_order_relaxed);
+    }
+    alloc_aligned_free(ring);
+}
+
+void isaac_ring_watermarks(isaac_ring_t* const ring,
+                           size_t low,
+                           size_t high)
+{
+    if (ring == NULL)
+    {
+        return;
+    }
+    high = RING_MIN(high, ring->capacity);
+    if (high < ISAAC_ELEMENTS)
+    {
+        high = ISAAC_ELEMENTS;
+    }
+    low = RING_MIN(low, high - 1U);
+    atomic_store(&ring->low, low);
+    atomic_store(&ring->high, high);
+}
+
+size_t isaac_ring_available(isaac_ring_t* const ring)
+{
+    if (ring == NULL)
+    {
+        return 0;
+    }
+    return ring_level(ring);
+}
+
+size_t isaac_ring_fill(isaac_ring_t* const ring)
+{
+    if (ring == NULL)
+    {
+        return 0;
+    }
+    isaac_uint_t batch[ISAAC_ELEMENTS];
+    const size_t mask = ring->capacity - 1U;
+    const size_t high = atomic_load_explicit(&ring->high,
+                                             memory_order_relaxed);
+    uint_fast64_t head = atomic_load_explicit(&ring->head,
+                                              memory_order_relaxed);
+    size_t batches = 0;
+    for (;;)
+    {
+        /* Acquire: the consumers are done reading up to the tail. */
+        const uint_fast64_t tail = atomic_load_explicit(
+                &ring->tail, memory_order_acquire);
+        if (head - tail + ISAAC_ELEMENTS > high)
+        {
+            break;
+        }
+        isaac_stream(&ring->ctx, batch, ISAAC_ELEMENTS);
+        const size_t start = (size_t) head & mask;
+        for (size_t i = 0; i < ISAAC_ELEMENTS; i++)
+        {
+            atomic_store_explicit(&ring->words[start + i], batch[i],
+                                  memory_order_relaxed);
+        }
+        head += ISAAC_ELEMENTS;
+        atomic_store_explicit(&ring->head, head, memory_order_release);
+        batches++;
+    }
+    memset(batch, 0, sizeof(batch));
+    return batches;
+}
+
+void isaac_ring_wait(isaac_ring_t* const ring)
+{
+#if ISAAC_THREADS
+    if (ring == NULL)
+    {
+        return;
+    }
+    pthread_mutex_lock(&ring->lock);
+    /* Seen by the consumers before they check the level, or they see the
+     * level after this check: the wake-up is never missed. */
+    atomic_store(&ring->sleeping, true);
+    while (!atomic_load(&ring->stop)
+           && ring_level(ring) > atomic_load(&ring->low))
+    {
+        pthread_cond_wait(&ring->wake, &ring->lock);
+    }
+    atomic_store(&ring->sleeping, false);
+    pthread_mutex_unlock(&ring->lock);
+#else
+    (void) ring;
+#endif
+}
+
+#if ISAAC_THREADS
+/**
+ * @internal
+ * Fills the ring and sleeps, until stopped. Entry point of the producer
+ * thread.
+ */
+static void* producer_main(void* const arg)
+{
+    isaac_ring_t* const ring = arg;
+    while (!atomic_load(&ring->stop))
+    {
+        isaac_ring_fill(ring);
+        isaac_ring_wait(ring);
+    }
+    return NULL;
+}
+#endif
+
+bool isaac_ring_start(isaac_ring_t* const ring)
+{
+#if ISAAC_THREADS
+    if (ring == NULL)
+    {
+        return false;
+    }
+    if (!ring->running)
+    {
+        ring->running = pthread_create(&ring->thread, NULL, producer_main,
+                                       ring) == 0;
+    }
+    return ring->running;
+#else
+    (void) ring;
+    return false;
+#endif
+}
+
+/**
+ * @internal
+ * Wakes up the producer if it sleeps and the level reached the low
+ * watermark.
+ */
+static void wake_producer(isaac_ring_t* const ring, const size_t level)
+{
+#if ISAAC_THREADS
+    if (level <= atomic_load_explicit(&ring->low, memory_order_relaxed)
+        && atomic_load(&ring->sleeping))
+    {
+        pthread_mutex_lock(&ring->lock);
+        pthread_cond_signal(&ring->wake);
+        pthread_mutex_unlock(&ring->lock);
+    }
+#else
+    (void) ring;
+    (void) level;
+#endif
+}
+
+size_t isaac_ring_read(isaac_ring_t* const ring,
+                       isaac_uint_t* const ints,
+                       const size_t amount)
+{
+    if (ring == NULL || ints == NULL || amount == 0)
+    {
+        return 0;
+    }
+    const size_t mask = ring->capacity - 1U;
+    uint_fast64_t tail = atomic_load_explicit(&ring->tail,
+                                              memory_order_relaxed);
+    uint_fast64_t head;
+    size_t taken;
+    do
+    {
+        head = atomic_load_explicit(&ring->head, memory_order_acquire);
+        taken = RING_MIN((size_t) (head - tail), amount);
+        for (size_t i = 0; i < taken; i++)
+        {
+            ints[i] = atomic_load_explicit(
+                    &ring->words[(size_t) (tail + i) & mask],
+                    memory_order_relaxed);
+        }
+        /* Claims the copied integers, after copying them, as the producer
+         * may reuse them right after. Sequentially consistent, as the
+         * sleeping flag checked next. */
+    }
+    while (taken != 0 && !atomic_compare_exchange_weak_explicit(
+            &ring->tail, &tail, tail + taken,
+            memory_order_seq_cst, memory_order_relaxed));
+    wake_producer(ring, (size_t) (head - tail - taken));
+    return taken;
+}
+
+size_t isaac_ring_read_bytes(isaac_ring_t* const ring,
+                             uint8_t* bytes,
+                             const size_t amount)
+{
+    if (ring == NULL || bytes == NULL)
+    {
+        return 0;
+    }
+    isaac_uint_t ints[RING_BYTES_CHUNK];
+    size_t done = 0;
+    while (done < amount)
+    {
+        const size_t wanted = RING_MIN(
+                (amount - done + sizeof(isaac_uint_t) - 1U)
+                / sizeof(isaac_uint_t), RING_BYTES_CHUNK);
+        const size_t taken = isaac_ring_read(ring, ints, wanted);
+        const size_t length = RING_MIN(taken * sizeof(isaac_uint_t),
+                                       amount - done);
+        if (length == taken * sizeof(isaac_uint_t))
+        {
+            isaac_to_little_endian(&bytes[done], ints, taken);
+        }
+        else
+        {
+            /* Last integer only partially used. */
+            uint8_t last[RING_BYTES_CHUNK * sizeof(isaac_uint_t)];
+            isaac_to_little_endian(last, ints, taken);
+            memcpy(&bytes[done], last, length);
+            memset(last, 0, sizeof(last));
+        }
+        done += length;
+        if (taken < wanted)
+        {
+            break;  /* Empty ring */
+        }
+    }
+    memset(ints, 0, sizeof(ints));
+    return done;
+}
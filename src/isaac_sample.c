@@ -0,0 +1,262 @@
+/**
+ * @file
+ *
+ * LibISAAC sampling without replacement: reservoir sampling of streams of
+ * unknown length and sorted random subsets of indices.
+ *
+ * Both skip over the items that are not taken, drawing random numbers only
+ * for the taken ones.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "isaac.h"
+#include "isaac_draw.h"
+#include <math.h>
+
+/* Algorithm D falls back to algorithm A when the sample is denser than
+ * 1 index out of this. */
+#define SAMPLE_DENSE_RATIO 13U
+
+/**
+ * @internal
+ * Draws a double in (0, 1], so its logarithm is finite.
+ */
+static inline double draw_positive_f64(isaac_draw_t* const draw)
+{
+    return (double) ((draw_u64(draw) >> 11U) + 1U) * 0x1.0p-53;
+}
+
+/**
+ * @internal
+ * Multiplies the weight of the reservoir by a new random factor and draws
+ * how many items follow before the next one entering it.
+ */
+static void reservoir_advance(isaac_reservoir_t* const res,
+                              isaac_draw_t* const draw)
+{
+    res->w *= exp(log(draw_positive_f64(draw)) / (double) res->k);
+    const double skip = floor(log(draw_positive_f64(draw))
+                              / log1p(-res->w));
+    if (!(skip < (double) (UINT64_MAX - res->seen)))
+    {
+        /* Beyond the range of the counter: no item enters again. */
+        res->next = UINT64_MAX;
+    }
+    else
+    {
+        res->next = res->seen + (uint64_t) skip;
+    }
+}
+
+void isaac_reservoir_init(isaac_reservoir_t* const res,
+                          isaac_ctx_t* const ctx,
+                          const size_t k)
+{
+    if (res == NULL || ctx == NULL)
+    {
+        return;
+    }
+    res->ctx = ctx;
+    res->k = k;
+    res->seen = 0;
+    res->next = 0;
+    res->w = 1.0;
+}
+
+size_t isaac_reservoir_offer(isaac_reservoir_t* const res)
+{
+    if (res == NULL || res->k == 0)
+    {
+        return ISAAC_RESERVOIR_SKIP;
+    }
+    const uint64_t index = res->seen++;
+    if (index < res->k)
+    {
+        /* Filling the reservoir. */
+        if (res->seen == res->k)
+        {
+            isaac_draw_t draw;
+            draw_begin(&draw, res->ctx);
+            reservoir_advance(res, &draw);
+            draw_end(&draw);
+        }
+        return (size_t) index;
+    }
+    if (index != res->next)
+    {
+        return ISAAC_RESERVOIR_SKIP;
+    }
+    isaac_draw_t draw;
+    draw_begin(&draw, res->ctx);
+    const size_t slot = draw_index(&draw, res->k);
+    reservoir_advance(res, &draw);
+    draw_end(&draw);
+    return slot;
+}
+
+uint64_t isaac_reservoir_skip(isaac_reservoir_t* const res,
+                              const uint64_t amount)
+{
+    if (res == NULL || res->k == 0 || res->seen < res->k)
+    {
+        return 0;
+    }
+    const uint64_t skippable = res->next - res->seen;
+    const uint64_t skipped = (amount < skippable) ? amount : skippable;
+    res->seen += skipped;
+    return skipped;
+}
+
+/**
+ * @internal
+ * Vitter's algorithm A: takes k of the n indices following `first`, drawing
+ * each skip by walking its distribution. O(n).
+ */
+static void sample_dense(isaac_draw_t* const draw,
+                         uint64_t first,
+                         uint64_t n,
+                         size_t k,
+                         uint64_t* out)
+{
+    double top = (double) (n - k);
+    double remaining = (double) n;
+    while (k >= 2U)
+    {
+        const double v = draw_positive_f64(draw);
+        uint64_t skip = 0;
+        double quot = top / remaining;
+        while (quot > v)
+        {
+            skip++;
+            top -= 1.0;
+            remaining -= 1.0;
+            quot *= top / remaining;
+        }
+        first += skip;
+        *out++ = first++;
+        remaining -= 1.0;
+        n -= skip + 1U;
+        k--;
+    }
+    /* The last one is uniform among the remaining indices. */
+    *out = first + draw_bounded_u64(draw, n);
+}
+
+/**
+ * @internal
+ * Vitter's algorithm D: draws each skip between the taken indices with a
+ * rejection method in constant expected time. O(k).
+ *
+ * The names of the variables follow the paper: `v` is the V' uniform raised
+ * to 1/k, reused across iterations, `qu1` is n - k + 1.
+ *
+ * Reference: J. S. Vitter, "An Efficient Algorithm for Sequential Random
+ * Sampling", ACM Transactions on Mathematical Software, 1987.
+ */
+static void sample_sparse(isaac_draw_t* const draw,
+                          uint64_t n,
+                          size_t k,
+                          uint64_t* out)
+{
+    uint64_t first = 0;
+    double k_inv = 1.0 / (double) k;
+    double v = exp(log(draw_positive_f64(draw)) * k_inv);
+    uint64_t qu1 = n - k + 1U;
+    while (k > 1U && (uint64_t) k * SAMPLE_DENSE_RATIO < n)
+    {
+        const double n_real = (double) n;
+        const double k_1_inv = 1.0 / (double) (k - 1U);
+        uint64_t skip;
+        for (;;)
+        {
+            double x;
+            for (;;)
+            {
+                /* Candidate skip from the continuous approximation. */
+                x = n_real * (1.0 - v);
+                skip = (uint64_t) x;
+                if (skip < qu1)
+                {
+                    break;
+                }
+                v = exp(log(draw_positive_f64(draw)) * k_inv);
+            }
+            const double u = draw_positive_f64(draw);
+            const double y1 = exp(log(u * n_real / (double) qu1) * k_1_inv);
+            v = y1 * (1.0 - x / n_real)
+                * ((double) qu1 / (double) (qu1 - skip));
+            if (v <= 1.0)
+            {
+                break;  /* Accepted by the quick test, v is reused */
+            }
+            /* Exact test, with the ratio of the falling factorials. */
+            double y2 = 1.0;
+            double top = n_real - 1.0;
+            double bottom;
+            uint64_t limit;
+            if (k - 1U > skip)
+            {
+                bottom = n_real - (double) k;
+                limit = n - skip;
+            }
+            else
+            {
+                bottom = n_real - (double) skip - 1.0;
+                limit = qu1;
+            }
+            for (uint64_t t = n - 1U; t >= limit; t--)
+            {
+                y2 = y2 * top / bottom;
+                top -= 1.0;
+                bottom -= 1.0;
+            }
+            if (n_real / (n_real - x) >= y1 * exp(log(y2) * k_1_inv))
+            {
+                v = exp(log(draw_positive_f64(draw)) * k_1_inv);
+                break;
+            }
+            v = exp(log(draw_positive_f64(draw)) * k_inv);
+        }
+        first += skip;
+        *out++ = first++;
+        n -= skip + 1U;
+        k--;
+        k_inv = k_1_inv;
+        qu1 -= skip;
+    }
+    if (k > 1U)
+    {
+        sample_dense(draw, first, n, k, out);
+    }
+    else
+    {
+        /* The last one is uniform among the remaining indices. */
+        *out = first + draw_bounded_u64(draw, n);
+    }
+}
+
+void isaac_sample_indices(isaac_ctx_t* const ctx,
+                          const uint64_t n,
+                          const size_t k,
+                          uint64_t* const out)
+{
+    if (ctx == NULL || out == NULL || k == 0 || k > n)
+    {
+        return;
+    }
+    if (k == n)
+    {
+        for (size_t i = 0; i < k; i++)
+        {
+            out[i] = i;
+        }
+        return;
+    }
+    isaac_draw_t draw;
+    draw_begin(&draw, ctx);
+    sample_sparse(&draw, n, k, out);
+    draw_end(&draw);
+}
@@ -0,0 +1,381 @@
+/**
+ * @file
+ *
+ * LibISAAC uniform distributions: integers in [0, bound), without the bias
+ * of the modulo reduction, and floating point numbers in [0, 1).
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "isaac.h"
+#include "isaac_kernel.h"
+#include "isaac_draw.h"
+
+/* Amount of 32 bit draws per vector of the bounded integers kernels. */
+#define UNIFORM_VECTOR_DRAWS 8U
+
+#define UNIFORM_MIN(a, b) (((a) < (b)) ? (a) : (b))
+
+/* Every multiple of 2^-24 in [0, 1) is a float. */
+#define UNIFORM_F32_BITS 24U
+#define UNIFORM_F32_ULP 0x1.0p-24F
+
+/**
+ * @internal
+ * Converts 32 random bits to a float in [0, 1), using the upper 24 of them.
+ */
+static inline float to_f32(const uint32_t bits)
+{
+    return (float) (bits >> (32U - UNIFORM_F32_BITS)) * UNIFORM_F32_ULP;
+}
+
+#if ISAAC_KERNEL_X86
+/**
+ * @internal
+ * Scales the random 32 bit values into [0, bound), 8 at the time, exactly as
+ * draw_bounded_u32() does, stopping at the first vector where a value could
+ * be rejected. The rest is left to the caller.
+ *
+ * Within a vector, the lower 32 bits of the products are compared to the
+ * bound: if none is lower, no value can be rejected and the upper 32 bits
+ * are the results.
+ *
+ * @return amount of values used, each providing one result.
+ */
+ISAAC_TARGET("avx2")
+static size_t uniform_u32_avx2(uint32_t* const out,
+                               const uint32_t* const values,
+                               const size_t amount,
+                               const uint32_t bound)
+{
+    const __m256i vbound = _mm256_set1_epi32((int) bound);
+    /* Unsigned comparisons as signed ones, after flipping the sign bit. */
+    const __m256i sign = _mm256_set1_epi32(INT32_MIN);
+    const __m256i sbound = _mm256_xor_si256(vbound, sign);
+    size_t i;
+    for (i = 0; i + UNIFORM_VECTOR_DRAWS <= amount; i += UNIFORM_VECTOR_DRAWS)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i*) (values + i));
+        const __m256i low = _mm256_mullo_epi32(v, vbound);
+        const __m256i rejectable = _mm256_cmpgt_epi32(
+                sbound, _mm256_xor_si256(low, sign));
+        if (!_mm256_testz_si256(rejectable, rejectable))
+        {
+            break;
+        }
+        /* 32x32 bit products of the even and odd elements. */
+        const __m256i even = _mm256_mul_epu32(v, vbound);
+        const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(v, 32), vbound);
+        const __m256i high = _mm256_blend_epi32(
+                _mm256_srli_epi64(even, 32), odd, 0xAA);
+        _mm256_storeu_si256((__m256i*) (out + i), high);
+    }
+    return i;
+}
+
+/**
+ * @internal
+ * Converts 64 bit values to doubles in [0, 1), 4 at the time, exactly as
+ * draw_to_f64() does.
+ *
+ * AVX2 has no 64 bit integer to double conversion, so the upper 52 bits
+ * are placed in the mantissa of a double in [1, 2), moved to [0, 1) with a
+ * subtraction, and the 53rd bit is added as 2^-53: all steps are exact.
+ *
+ * With ISAAC, each 64 bit value is made of two words, the first being the
+ * upper half, as draw_u64() does.
+ *
+ * @return amount of values converted, the rest is left to the caller.
+ */
+ISAAC_TARGET("avx2")
+static size_t uniform_f64_avx2(double* const out,
+                               const isaac_uint_t* const words,
+                               const size_t amount)
+{
+    const size_t step = sizeof(uint64_t) / sizeof(isaac_uint_t);
+    const __m256i exponent = _mm256_set1_epi64x(0x3FF0000000000000LL);
+    const __m256i lowest = _mm256_set1_epi64x(1);
+    const __m256d one = _mm256_set1_pd(1.0);
+    const __m256d ulp = _mm256_set1_pd(DRAW_F64_ULP);
+    size_t i;
+    for (i = 0; i + 4U <= amount; i += 4U)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*) (words + i * step));
+#if ISAAC_BITS == 32
+        v = _mm256_shuffle_epi32(v, 0xB1);
+#endif
+        const __m256i mantissa = _mm256_or_si256(
+                _mm256_srli_epi64(v, 64 - DRAW_F64_BITS + 1), exponent);
+        const __m256i bit53 = _mm256_cmpeq_epi64(
+                _mm256_and_si256(_mm256_srli_epi64(v, 64 - DRAW_F64_BITS),
+                                 lowest), lowest);
+        const __m256d d = _mm256_add_pd(
+                _mm256_sub_pd(_mm256_castsi256_pd(mantissa), one),
+                _mm256_and_pd(_mm256_castsi256_pd(bit53), ulp));
+        _mm256_storeu_pd(out + i, d);
+    }
+    return i;
+}
+
+/**
+ * @internal
+ * Converts 32 bit values to floats in [0, 1), 8 at the time, exactly as
+ * to_f32() does.
+ *
+ * @return amount of values converted, the rest is left to the caller.
+ */
+ISAAC_TARGET("avx2")
+static size_t uniform_f32_avx2(float* const out,
+                               const uint32_t* const values,
+                               const size_t amount)
+{
+    const __m256 ulp = _mm256_set1_ps(UNIFORM_F32_ULP);
+    size_t i;
+    for (i = 0; i + 8U <= amount; i += 8U)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i*) (values + i));
+        /* The upper 24 bits are positive as signed integers too. */
+        const __m256 f = _mm256_cvtepi32_ps(
+                _mm256_srli_epi32(v, 32 - UNIFORM_F32_BITS));
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(f, ulp));
+    }
+    return i;
+}
+#endif
+
+/**
+ * @internal
+ * Bounded 32 bit integers straight from the words lent to the reader, with
+ * the widest vector kernel available.
+ *
+ * @return amount of integers written, possibly 0, to be continued by the
+ * caller with draw_bounded_u32().
+ */
+static size_t uniform_u32_vector(isaac_draw_t* const draw,
+                                 uint32_t* const out,
+                                 const size_t count,
+                                 const uint32_t bound)
+{
+#if ISAAC_KERNEL_X86
+    /* x86 is little endian: the 32 bit halves of the ISAAC-64 words are in
+     * the order draw_u32() provides them, lower half first. */
+    const size_t halves = sizeof(isaac_uint_t) / sizeof(uint32_t);
+    const uint32_t* const values = (const uint32_t*) &draw->words[draw->used];
+    const size_t amount = UNIFORM_MIN(
+            count, (draw->available - draw->used) * halves);
+    size_t done;
+#if ISAAC_BITS > 32
+    if (draw->has_half)
+    {
+        return 0;
+    }
+#endif
+    switch (isaac_kernel())
+    {
+        case ISAAC_KERNEL_AVX512:
+        case ISAAC_KERNEL_AVX2:
+            done = uniform_u32_avx2(out, values, amount, bound);
+            break;
+        case ISAAC_KERNEL_PORTABLE:
+        case ISAAC_KERNEL_SSE4:
+        case ISAAC_KERNEL_NEON:
+        default:
+            done = 0;
+            break;
+    }
+    /* The vectors contain whole words. */
+    draw->used += done / halves;
+    return done;
+#else
+    (void) draw;
+    (void) out;
+    (void) count;
+    (void) bound;
+    return 0;
+#endif
+}
+
+void isaac_uniform_u32(isaac_ctx_t* const ctx,
+                       uint32_t* out,
+                       size_t count,
+                       const uint32_t bound)
+{
+    if (ctx == NULL || out == NULL || bound == 0)
+    {
+        return;
+    }
+    isaac_draw_t draw;
+    draw_begin(&draw, ctx);
+    while (count)
+    {
+        const size_t done = uniform_u32_vector(&draw, out, count, bound);
+        out += done;
+        count -= done;
+        /* Past the possible rejection or the end of the batch stopping the
+         * vectors, if any. */
+        for (uint_fast8_t i = 0; i < UNIFORM_VECTOR_DRAWS && count; i++)
+        {
+            *out++ = draw_bounded_u32(&draw, bound);
+            count--;
+        }
+    }
+    draw_end(&draw);
+}
+
+void isaac_uniform_u64(isaac_ctx_t* const ctx,
+                       uint64_t* out,
+                       size_t count,
+                       const uint64_t bound)
+{
+    if (ctx == NULL || out == NULL || bound == 0)
+    {
+        return;
+    }
+    isaac_draw_t draw;
+    draw_begin(&draw, ctx);
+    while (count--)
+    {
+        *out++ = draw_bounded_u64(&draw, bound);
+    }
+    draw_end(&draw);
+}
+
+/**
+ * @internal
+ * Doubles straight from the words lent to the reader, with the widest vector
+ * kernel available.
+ *
+ * @return amount of doubles written, possibly 0, to be continued by the
+ * caller with draw_f64().
+ */
+static size_t uniform_f64_vector(isaac_draw_t* const draw,
+                                 double* const out,
+                                 const size_t count)
+{
+#if ISAAC_KERNEL_X86
+    /* With ISAAC, each double takes two words: a pair straddling two
+     * batches is left to the caller. */
+    const size_t words = sizeof(uint64_t) / sizeof(isaac_uint_t);
+    const size_t amount = UNIFORM_MIN(
+            count, (draw->available - draw->used) / words);
+    size_t done;
+    switch (isaac_kernel())
+    {
+        case ISAAC_KERNEL_AVX512:
+        case ISAAC_KERNEL_AVX2:
+            done = uniform_f64_avx2(out, &draw->words[draw->used], amount);
+            break;
+        case ISAAC_KERNEL_PORTABLE:
+        case ISAAC_KERNEL_SSE4:
+        case ISAAC_KERNEL_NEON:
+        default:
+            done = 0;
+            break;
+    }
+    draw->used += done * words;
+    return done;
+#else
+    (void) draw;
+    (void) out;
+    (void) count;
+    return 0;
+#endif
+}
+
+/**
+ * @internal
+ * Floats straight from the words lent to the reader, with the widest vector
+ * kernel available.
+ *
+ * @return amount of floats written, possibly 0, to be continued by the
+ * caller with to_f32().
+ */
+static size_t uniform_f32_vector(isaac_draw_t* const draw,
+                                 float* const out,
+                                 const size_t count)
+{
+#if ISAAC_KERNEL_X86
+    /* x86 is little endian: the 32 bit halves of the ISAAC-64 words are in
+     * the order draw_u32() provides them, lower half first. */
+    const size_t halves = sizeof(isaac_uint_t) / sizeof(uint32_t);
+    const uint32_t* const values = (const uint32_t*) &draw->words[draw->used];
+    const size_t amount = UNIFORM_MIN(
+            count, (draw->available - draw->used) * halves);
+    size_t done;
+#if ISAAC_BITS > 32
+    if (draw->has_half)
+    {
+        return 0;
+    }
+#endif
+    switch (isaac_kernel())
+    {
+        case ISAAC_KERNEL_AVX512:
+        case ISAAC_KERNEL_AVX2:
+            done = uniform_f32_avx2(out, values, amount);
+            break;
+        case ISAAC_KERNEL_PORTABLE:
+        case ISAAC_KERNEL_SSE4:
+        case ISAAC_KERNEL_NEON:
+        default:
+            done = 0;
+            break;
+    }
+    /* The vectors contain whole words. */
+    draw->used += done / halves;
+    return done;
+#else
+    (void) draw;
+    (void) out;
+    (void) count;
+    return 0;
+#endif
+}
+
+void isaac_uniform_f64(isaac_ctx_t* const ctx, double* out, size_t count)
+{
+    if (ctx == NULL || out == NULL)
+    {
+        return;
+    }
+    isaac_draw_t draw;
+    draw_begin(&draw, ctx);
+    while (count)
+    {
+        const size_t done = uniform_f64_vector(&draw, out, count);
+        out += done;
+        count -= done;
+        /* The vectors stop only at the end of the batch or of the output. */
+        if (count)
+        {
+            *out++ = draw_f64(&draw);
+            count--;
+        }
+    }
+    draw_end(&draw);
+}
+
+void isaac_uniform_f32(isaac_ctx_t* const ctx, float* out, size_t count)
+{
+    if (ctx == NULL || out == NULL)
+    {
+        return;
+    }
+    isaac_draw_t draw;
+    draw_begin(&draw, ctx);
+    while (count)
+    {
+        const size_t done = uniform_f32_vector(&draw, out, count);
+        out += done;
+        count -= done;
+        /* The vectors stop only at the end of the batch or of the output. */
+        if (count)
+        {
+            *out++ = to_f32(draw_u32(&draw));
+            count--;
+        }
+    }
+    draw_end(&draw);
+}
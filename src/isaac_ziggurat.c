@@ -0,0 +1,260 @@
+/**
+ * @file
+ *
+ * LibISAAC normal and exponential distributions, sampled with ziggurats.
+ *
+ * Each sample starts from 64 random bits: the lowest 8 pick the layer, the
+ * 9th the sign of normal samples and the highest 52 the position within the
+ * layer. See isaac_ziggurat.h for the method.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "isaac.h"
+#include "isaac_kernel.h"
+#include "isaac_draw.h"
+#include "isaac_ziggurat.h"
+#include <math.h>
+
+/* Amount of samples per vector of the ziggurat kernels. */
+#define ZIGGURAT_VECTOR_SAMPLES 4U
+
+#define ZIGGURAT_LAYER(bits) ((uint_fast8_t) ((bits) & 0xFFU))
+#define ZIGGURAT_NEGATIVE(bits) (((bits) & 0x100U) != 0)
+#define ZIGGURAT_WIDTH(bits) ((bits) >> (64U - ISAAC_ZIGGURAT_BITS))
+
+#define ZIGGURAT_MIN(a, b) (((a) < (b)) ? (a) : (b))
+
+/**
+ * @internal
+ * Samples the standard normal distribution.
+ */
+static double normal(isaac_draw_t* const draw)
+{
+    const isaac_ziggurat_t* const z = &isaac_ziggurat_normal;
+    for (;;)
+    {
+        const uint64_t bits = draw_u64(draw);
+        const uint_fast8_t layer = ZIGGURAT_LAYER(bits);
+        const uint64_t width = ZIGGURAT_WIDTH(bits);
+        double x = (double) width * z->w[layer];
+        if (ZIGGURAT_NEGATIVE(bits))
+        {
+            x = -x;
+        }
+        if (width < z->k[layer])
+        {
+            return x;
+        }
+        if (layer == 0)
+        {
+            /* Tail beyond r, with Marsaglia's method. 1 - u is in (0, 1]. */
+            double tail;
+            double y;
+            do
+            {
+                tail = -log(1.0 - draw_f64(draw)) / z->r;
+                y = -log(1.0 - draw_f64(draw));
+            }
+            while (y + y < tail * tail);
+            return ZIGGURAT_NEGATIVE(bits) ? -(z->r + tail) : z->r + tail;
+        }
+        if (z->f[layer] + draw_f64(draw) * (z->f[layer + 1U] - z->f[layer])
+            < exp(-0.5 * x * x))
+        {
+            return x;
+        }
+    }
+}
+
+/**
+ * @internal
+ * Samples the exponential distribution with rate 1.
+ */
+static double exponential(isaac_draw_t* const draw)
+{
+    const isaac_ziggurat_t* const z = &isaac_ziggurat_exponential;
+    double offset = 0.0;
+    for (;;)
+    {
+        const uint64_t bits = draw_u64(draw);
+        const uint_fast8_t layer = ZIGGURAT_LAYER(bits);
+        const uint64_t width = ZIGGURAT_WIDTH(bits);
+        const double x = (double) width * z->w[layer];
+        if (width < z->k[layer])
+        {
+            return offset + x;
+        }
+        if (layer == 0)
+        {
+            /* The tail beyond r is again exponential, shifted by r. */
+            offset += z->r;
+        }
+        else if (z->f[layer]
+                 + draw_f64(draw) * (z->f[layer + 1U] - z->f[layer])
+                 < exp(-x))
+        {
+            return offset + x;
+        }
+    }
+}
+
+#if ISAAC_KERNEL_X86
+/**
+ * @internal
+ * Fast path of the ziggurat, 4 samples at the time, exactly as normal() and
+ * exponential() do, stopping at the first vector where a sample is not
+ * accepted right away. The rest is left to the caller.
+ *
+ * With ISAAC, each 64 bit value is made of two words, the first being the
+ * upper half, as draw_u64() does.
+ *
+ * @param symmetric true for the normal distribution, applying the sign bit.
+ * @return amount of values used, each providing one sample.
+ */
+ISAAC_TARGET("avx2")
+static size_t ziggurat_avx2(double* const out,
+                            const isaac_uint_t* const words,
+                            const size_t amount,
+                            const isaac_ziggurat_t* const z,
+                            const bool symmetric)
+{
+    const size_t step = sizeof(uint64_t) / sizeof(isaac_uint_t);
+    const __m256i layer_mask = _mm256_set1_epi64x(0xFF);
+    const __m256i sign_mask = _mm256_set1_epi64x(0x100);
+    /* Integers below 2^52 become doubles by placing them in the mantissa of
+     * 2^52 and subtracting it. */
+    const __m256i exponent = _mm256_set1_epi64x(0x4330000000000000LL);
+    const __m256d two52 = _mm256_set1_pd(0x1.0p52);
+    size_t i;
+    for (i = 0; i + ZIGGURAT_VECTOR_SAMPLES <= amount;
+         i += ZIGGURAT_VECTOR_SAMPLES)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*) (words + i * step));
+#if ISAAC_BITS == 32
+        v = _mm256_shuffle_epi32(v, 0xB1);
+#endif
+        const __m256i layer = _mm256_and_si256(v, layer_mask);
+        const __m256i width = _mm256_srli_epi64(v, 64 - ISAAC_ZIGGURAT_BITS);
+        const __m256i k = _mm256_i64gather_epi64(
+                (const long long*) z->k, layer, 8);
+        /* Both below 2^52: the signed comparison is correct. */
+        const __m256i accepted = _mm256_cmpgt_epi64(k, width);
+        if (_mm256_movemask_pd(_mm256_castsi256_pd(accepted)) != 0xF)
+        {
+            break;
+        }
+        const __m256d w = _mm256_i64gather_pd(z->w, layer, 8);
+        const __m256d d = _mm256_sub_pd(
+                _mm256_castsi256_pd(_mm256_or_si256(width, exponent)), two52);
+        __m256d x = _mm256_mul_pd(d, w);
+        if (symmetric)
+        {
+            const __m256i sign = _mm256_slli_epi64(
+                    _mm256_and_si256(v, sign_mask), 55);
+            x = _mm256_xor_pd(x, _mm256_castsi256_pd(sign));
+        }
+        _mm256_storeu_pd(out + i, x);
+    }
+    return i;
+}
+#endif
+
+/**
+ * @internal
+ * Fast path of the ziggurat straight from the words lent to the reader, with
+ * the widest vector kernel available.
+ *
+ * @return amount of samples written, possibly 0, to be continued by the
+ * caller with normal() or exponential().
+ */
+static size_t ziggurat_vector(isaac_draw_t* const draw,
+                              double* const out,
+                              const size_t count,
+                              const isaac_ziggurat_t* const z,
+                              const bool symmetric)
+{
+#if ISAAC_KERNEL_X86
+    /* With ISAAC, each sample takes two words: a pair straddling two
+     * batches is left to the caller. */
+    const size_t words = sizeof(uint64_t) / sizeof(isaac_uint_t);
+    const size_t amount = ZIGGURAT_MIN(
+            count, (draw->available - draw->used) / words);
+    size_t done;
+    switch (isaac_kernel())
+    {
+        case ISAAC_KERNEL_AVX512:
+        case ISAAC_KERNEL_AVX2:
+            done = ziggurat_avx2(out, &draw->words[draw->used], amount,
+                                 z, symmetric);
+            break;
+        case ISAAC_KERNEL_PORTABLE:
+        case ISAAC_KERNEL_SSE4:
+        case ISAAC_KERNEL_NEON:
+        default:
+            done = 0;
+            break;
+    }
+    draw->used += done * words;
+    return done;
+#else
+    (void) draw;
+    (void) out;
+    (void) count;
+    (void) z;
+    (void) symmetric;
+    return 0;
+#endif
+}
+
+void isaac_normal_f64(isaac_ctx_t* const ctx, double* out, size_t count)
+{
+    if (ctx == NULL || out == NULL)
+    {
+        return;
+    }
+    isaac_draw_t draw;
+    draw_begin(&draw, ctx);
+    while (count)
+    {
+        const size_t done = ziggurat_vector(
+                &draw, out, count, &isaac_ziggurat_normal, true);
+        out += done;
+        count -= done;
+        /* Past the slow sample or the end of the batch stopping the vectors,
+         * if any. */
+        for (uint_fast8_t i = 0; i < ZIGGURAT_VECTOR_SAMPLES && count; i++)
+        {
+            *out++ = normal(&draw);
+            count--;
+        }
+    }
+    draw_end(&draw);
+}
+
+void isaac_exponential_f64(isaac_ctx_t* const ctx, double* out, size_t count)
+{
+    if (ctx == NULL || out == NULL)
+    {
+        return;
+    }
+    isaac_draw_t draw;
+    draw_begin(&draw, ctx);
+    while (count)
+    {
+        const size_t done = ziggurat_vector(
+                &draw, out, count, &isaac_ziggurat_exponential, false);
+        out += done;
+        count -= done;
+        /* Past the slow sample or the end of the batch stopping the vectors,
+         * if any. */
+        for (uint_fast8_t i = 0; i < ZIGGURAT_VECTOR_SAMPLES && count; i++)
+        {
+            *out++ = exponential(&draw);
+            count--;
+        }
+    }
+    draw_end(&draw);
+}
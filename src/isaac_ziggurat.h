@@ -0,0 +1,68 @@
+/**
+ * @file
+ *
+ * LibISAAC internal header: tables of the ziggurat samplers.
+ *
+ * The area under the density `f(x)` for `x >= 0` is covered by
+ * #ISAAC_ZIGGURAT_LAYERS horizontal layers of equal area `v`. Layer `i` is the
+ * rectangle spanning `[0, x[i]]` horizontally and `[f(x[i]), f(x[i+1])]`
+ * vertically, with `x[1] = r`, `x[i+1] = f^-1(f(x[i]) + v / x[i])` and
+ * `x[256] = 0`. The base layer 0 is a rectangle of width `x[0] = v / f(r)`,
+ * `r` being the start of the tail, together with the tail itself.
+ *
+ * A sample picks a layer and a point `x` within its width. When `x < x[i+1]`
+ * the point is under the density whatever its height: this is the fast path
+ * of about 99% of the samples, costing a multiplication and a comparison.
+ * The rest is resolved by sampling the height (wedges) or the tail.
+ *
+ * Reference: G. Marsaglia and W. W. Tsang, "The Ziggurat Method for
+ * Generating Random Variables", Journal of Statistical Software, 2000.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#ifndef ISAAC_ZIGGURAT_H
+#define ISAAC_ZIGGURAT_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#include <stdint.h>
+
+/** @internal Amount of layers of the ziggurats, indexed by 8 random bits. */
+#define ISAAC_ZIGGURAT_LAYERS 256U
+
+/** @internal Random bits scaled to the width of a layer. */
+#define ISAAC_ZIGGURAT_BITS 52U
+
+/**
+ * @internal
+ * Ziggurat of a decreasing density over `x >= 0`.
+ */
+typedef struct
+{
+    /** Start of the tail, right edge of layer 1. */
+    double r;
+    /** `2^52 * x[i+1] / x[i]`: random widths below it are always under f. */
+    uint64_t k[ISAAC_ZIGGURAT_LAYERS];
+    /** `x[i] / 2^52`: scales random widths to the layer. */
+    double w[ISAAC_ZIGGURAT_LAYERS];
+    /** `f(x[i])`: bottom edge of the layers, 1 at the top. */
+    double f[ISAAC_ZIGGURAT_LAYERS + 1U];
+} isaac_ziggurat_t;
+
+/** @internal Ziggurat of the normal distribution, `f(x) = e^(-x^2/2)`. */
+extern const isaac_ziggurat_t isaac_ziggurat_normal;
+
+/** @internal Ziggurat of the exponential distribution, `f(x) = e^(-x)`. */
+extern const isaac_ziggurat_t isaac_ziggurat_exponential;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* ISAAC_ZIGGURAT_H */
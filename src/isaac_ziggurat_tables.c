@@ -0,0 +1,722 @@
+/**
+ * @file
+ *
+ * LibISAAC ziggurat tables, shared by both ISAAC variants.
+ *
+ * Built with 50 significant digits from the constants of Marsaglia and
+ * Tsang for 256 layers, as described in isaac_ziggurat.h, then rounded to
+ * the nearest double. Being constants, they produce the same samples on
+ * every platform.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "isaac_ziggurat.h"
+
+const isaac_ziggurat_t isaac_ziggurat_normal = {
+        .r = 3.6541528853610088,
+        .k = {
+                0xEF33D8025BC37ULL, 0xF1A5A4B331A0AULL, 0xF66C5F7F02F19ULL,
+                0xF89FA48A41D48ULL, 0xF9E971E014510ULL, 0xFAC40582A2805ULL,
+                0xFB606C40053D5ULL, 0xFBD6581C0B7E6ULL, 0xFC32B2F1E22A1ULL,
+                0xFC7D26ECD2CDDULL, 0xFCBA8D85E1170ULL, 0xFCEE204761F61ULL,
+                0xFD1A1A7B4C772ULL, 0xFD40149E2EFDAULL, 0xFD613ADBD64D5ULL,
+                0xFD7E6EF48CED0ULL, 0xFD985E1B2BA42ULL, 0xFDAF8F82E0251ULL,
+                0xFDC46E529BEE3ULL, 0xFDD7509C63BCEULL, 0xFDE87C57EFE7CULL,
+                0xFDF82B02B717CULL, 0xFE068C4EE6782ULL, 0xFE13C827882E8ULL,
+                0xFE2000399552BULL, 0xFE2B5122FE4D2ULL, 0xFE35D35EEB171ULL,
+                0xFE3F9BFFD1E0DULL, 0xFE48BD436F42DULL, 0xFE51470977256ULL,
+                0xFE5947338F718ULL, 0xFE60C9F383054ULL, 0xFE67DA0B6ABAFULL,
+                0xFE6E8102AA1D9ULL, 0xFE74C751F6A7CULL, 0xFE7AB48823396ULL,
+                0xFE804F690A917ULL, 0xFE859E07AB1C1ULL, 0xFE8AA5DC4E8BDULL,
+                0xFE8F6BD76C5ADULL, 0xFE93F471D4700ULL, 0xFE9843BA9477AULL,
+                0xFE9C5D62F5611ULL, 0xFEA044C8DD9CEULL, 0xFEA3FCFFD73BCULL,
+                0xFEA788D8EE2FEULL, 0xFEAAEAE99222EULL, 0xFEAE2591A02C0ULL,
+                0xFEB13B00B2D22ULL, 0xFEB42D3AD1F75ULL, 0xFEB6FE1C98519ULL,
+                0xFEB9AF5EE0CB2ULL, 0xFEBC429A0B667ULL, 0xFEBEB948E6FA7ULL,
+                0xFEC114CB4B30AULL, 0xFEC356686C938ULL, 0xFEC57F50F31D3ULL,
+                0xFEC790A0DA94EULL, 0xFEC98B6123096ULL, 0xFECB708956E89ULL,
+                0xFECD4100EB78DULL, 0xFECEFDA07FE08ULL, 0xFED0A732FE618ULL,
+                0xFED23E76A2FABULL, 0xFED3C41DEA3F6ULL, 0xFED538D06ADD3ULL,
+                0xFED69D2B9BFFEULL, 0xFED7F1C38A809ULL, 0xFED937237E95FULL,
+                0xFEDA6DCE9389CULL, 0xFEDB964042CC6ULL, 0xFEDCB0ECE39A5ULL,
+                0xFEDDBE422044FULL, 0xFEDEBEA76213DULL, 0xFEDFB27E3499CULL,
+                0xFEE09A22A1417ULL, 0xFEE175EB83C2AULL, 0xFEE2462AD81D4ULL,
+                0xFEE30B2E02AA6ULL, 0xFEE3C53E12C1EULL, 0xFEE474A00069DULL,
+                0xFEE51994E5784ULL, 0xFEE5B45A32856ULL, 0xFEE64529E004CULL,
+                0xFEE6CC3A9BD2BULL, 0xFEE749BFF37CBULL, 0xFEE7BDEA7B854ULL,
+                0xFEE828E7F3DC8ULL, 0xFEE88AE369C44ULL, 0xFEE8E405574E0ULL,
+                0xFEE93473C0A03ULL, 0xFEE97C524F2ADULL, 0xFEE9BBC26AEF7ULL,
+                0xFEE9F2E351FEDULL, 0xFEEA21D22E4A1ULL, 0xFEEA48AA29E4AULL,
+                0xFEEA678481CEBULL, 0xFEEA7E789761AULL, 0xFEEA8D9C00723ULL,
+                0xFEEA9502963D4ULL, 0xFEEA94BE83300ULL, 0xFEEA8CE04F9CEULL,
+                0xFEEA7D76ED6BCULL, 0xFEEA668FC2D33ULL, 0xFEEA4836B426DULL,
+                0xFEEA22762CC6FULL, 0xFEE9F557273B4ULL, 0xFEE9C0E13481AULL,
+                0xFEE9851A829AAULL, 0xFEE94207E2598ULL, 0xFEE8F7ACCC80FULL,
+                0xFEE8A60B662FFULL, 0xFEE84D2484A6EULL, 0xFEE7ECF7B0674ULL,
+                0xFEE7858327B3BULL, 0xFEE716C3E0733ULL, 0xFEE6A0B5897A8ULL,
+                0xFEE623528B3E5ULL, 0xFEE59E9407EF7ULL, 0xFEE51271DB03BULL,
+                0xFEE47EE2982A8ULL, 0xFEE3E3DB89AF0ULL, 0xFEE34150AE46EULL,
+                0xFEE29734B64D5ULL, 0xFEE1E57900690ULL, 0xFEE12C0D959B5ULL,
+                0xFEE06AE124B73ULL, 0xFEDFA1E0FD3C0ULL, 0xFEDED0F90992BULL,
+                0xFEDDF813C8A7CULL, 0xFEDD171A46DFBULL, 0xFEDC2DF4165FAULL,
+                0xFEDB3C8746A5AULL, 0xFEDA42B85B6A9ULL, 0xFED9406A42C6DULL,
+                0xFED8357E4A924ULL, 0xFED721D414F89ULL, 0xFED605498C37CULL,
+                0xFED4DFBAD580CULL, 0xFED3B10242EE8ULL, 0xFED278F84489EULL,
+                0xFED13773584C1ULL, 0xFECFEC47F914FULL, 0xFECE97488C849ULL,
+                0xFECD38454FAA9ULL, 0xFECBCF0C42790ULL, 0xFECA5B6911EA1ULL,
+                0xFEC8DD2500C42ULL, 0xFEC75406CEE80ULL, 0xFEC5BFD29F120ULL,
+                0xFEC42049DAF5BULL, 0xFEC2752B1599AULL, 0xFEC0BE31EBD6CULL,
+                0xFEBEFB16E2DBFULL, 0xFEBD2B8F4494EULL, 0xFEBB4F4CF9CF8ULL,
+                0xFEB965FE61F8DULL, 0xFEB76F4E28471ULL, 0xFEB56AE316229ULL,
+                0xFEB3585FE29BCULL, 0xFEB13762FEB81ULL, 0xFEAF07865E5A8ULL,
+                0xFEACC85F3D889ULL, 0xFEAA797DE1C55ULL, 0xFEA81A6D5737CULL,
+                0xFEA5AAB32948CULL, 0xFEA329CF16600ULL, 0xFEA0973ABE5D4ULL,
+                0xFE9DF2694B62AULL, 0xFE9B3AC7147B6ULL, 0xFE986FB9399EEULL,
+                0xFE95909D38833ULL, 0xFE929CC879A61ULL, 0xFE8F9387D4E36ULL,
+                0xFE8C741F0CDF7ULL, 0xFE893DC84079BULL, 0xFE85EFB35166DULL,
+                0xFE8289053EFB9ULL, 0xFE7F08D77416AULL, 0xFE7B6E3706FC3ULL,
+                0xFE77B823E9D55ULL, 0xFE73E5900A617ULL, 0xFE6FF55E5F402ULL,
+                0xFE6BE661E10B4ULL, 0xFE67B75C6D47BULL, 0xFE6366FD90F73ULL,
+                0xFE5EF3E13857DULL, 0xFE5A5C8E410FFULL, 0xFE559F74EBB5CULL,
+                0xFE50BAED29400ULL, 0xFE4BAD34C082FULL, 0xFE46746D475FFULL,
+                0xFE410E99EAC3FULL, 0xFE3B799CFFEE1ULL, 0xFE35B33558BF7ULL,
+                0xFE2FB8FB54027ULL, 0xFE29885DA1A27ULL, 0xFE231E9DB1B32ULL,
+                0xFE1C78CBC3E15ULL, 0xFE1593C28B6BAULL, 0xFE0E6C225A0B8ULL,
+                0xFE06FE4BC2342ULL, 0xFDFF46599EB7FULL, 0xFDF7401A6B25EULL,
+                0xFDEEE708D4F6CULL, 0xFDE6364369D6EULL, 0xFDDD288342D86ULL,
+                0xFDD3B8118707EULL, 0xFDC9DEBB99847ULL, 0xFDBF95C5BFA83ULL,
+                0xFDB4D5DC02BB8ULL, 0xFDA9970105C08ULL, 0xFD9DD07A7AB31ULL,
+                0xFD9178BAD29CAULL, 0xFD848547B0605ULL, 0xFD76EA9C8E52AULL,
+                0xFD689C08E96BDULL, 0xFD598B8920BF9ULL, 0xFD49A9990B0F2ULL,
+                0xFD38E4FF0C564ULL, 0xFD272A8E2F060ULL, 0xFD1464DD6C0BAULL,
+                0xFD007BF1DC4C5ULL, 0xFCEB54D8FE7E7ULL, 0xFCD4D12F834C5ULL,
+                0xFCBCCE9021DC6ULL, 0xFCA325E4BD8D3ULL, 0xFC87AA928908AULL,
+                0xFC6A2977AE7A2ULL, 0xFC4A67AE254C2ULL, 0xFC28210379AA9ULL,
+                0xFC03060FF6415ULL, 0xFBDAB9D0402F3ULL, 0xFBAECE9A1DB41ULL,
+                0xFB7EC2366F3BCULL, 0xFB49F8D5368F7ULL, 0xFB0FB6718AC00ULL,
+                0xFACF160D34659ULL, 0xFA86FDE5B3BBEULL, 0xFA360F581E82DULL,
+                0xF9DA907DBE050ULL, 0xF9724C74DB926ULL, 0xF8FA657830A7CULL,
+                0xF86F10C6337D7ULL, 0xF7CB2EC281EC1ULL, 0xF707A75536926ULL,
+                0xF61A5E41B6BE1ULL, 0xF4F469560DF94ULL, 0xF37ED61FF712BULL,
+                0xF19470AF9CC7CULL, 0xEEF4B817E2216ULL, 0xEB255E9D2FA38ULL,
+                0xE51F67EC049A7ULL, 0xDA354FABA421DULL, 0xC08BE98F2AC65ULL,
+                0x0000000000000ULL
+        },
+        .w = {
+                0x1.f493b7816449cp-51, 0x1.d3bb48209ad33p-51,
+                0x1.b981f3878f995p-51, 0x1.a8fdc7894718cp-51,
+                0x1.9cbee014050dfp-51, 0x1.92ee0946f3d1ap-51,
+                0x1.8ab0fbfaa7412p-51, 0x1.839030529e9c6p-51,
+                0x1.7d42df4d6c5c3p-51, 0x1.779955608fd5cp-51,
+                0x1.72728f05f70d7p-51, 0x1.6db6b8d09d896p-51,
+                0x1.69540be9fdbedp-51, 0x1.653ce7b0060e0p-51,
+                0x1.61669cf861410p-51, 0x1.5dc8a243ac693p-51,
+                0x1.5a5c08b718342p-51, 0x1.571b1a94ad95ap-51,
+                0x1.54011523a7359p-51, 0x1.5109f53e9a131p-51,
+                0x1.4e3250dcd7dccp-51, 0x1.4b7739d6b4ecdp-51,
+                0x1.48d62759c383ep-51, 0x1.464ce44a72e74p-51,
+                0x1.43d98155452d1p-51, 0x1.417a49cb9d9f7p-51,
+                0x1.3f2dbaa60e871p-51, 0x1.3cf27b316f883p-51,
+                0x1.3ac7570ae7cb8p-51, 0x1.38ab3925634aap-51,
+                0x1.369d27a339bc2p-51, 0x1.349c405ae0607p-51,
+                0x1.32a7b5e6897eap-51, 0x1.30becd256a218p-51,
+                0x1.2ee0db1a96c03p-51, 0x1.2d0d43196ce89p-51,
+                0x1.2b4375329fd28p-51, 0x1.2982ecd770132p-51,
+                0x1.27cb2faa84bccp-51, 0x1.261bcc7764b64p-51,
+                0x1.24745a4ac8e8dp-51, 0x1.22d477a6fc63dp-51,
+                0x1.213bc9d04beb5p-51, 0x1.1fa9fc2e2cb1ap-51,
+                0x1.1e1ebfbe4a038p-51, 0x1.1c99ca9719879p-51,
+                0x1.1b1ad777f215ap-51, 0x1.19a1a564edd5dp-51,
+                0x1.182df74d203f9p-51, 0x1.16bf93b9de071p-51,
+                0x1.1556448601fa0p-51, 0x1.13f1d69c3fab8p-51,
+                0x1.129219bbb4e67p-51, 0x1.1136e04206159p-51,
+                0x1.0fdffefa690b4p-51, 0x1.0e8d4cf115677p-51,
+                0x1.0d3ea34aa2dfbp-51, 0x1.0bf3dd1eec4f9p-51,
+                0x1.0aacd7571b15cp-51, 0x1.0969708e892d2p-51,
+                0x1.082988f631e7bp-51, 0x1.06ed023a716b3p-51,
+                0x1.05b3bf6ada3afp-51, 0x1.047da4e3ee5dep-51,
+                0x1.034a983a8f2a9p-51, 0x1.021a8028fb92bp-51,
+                0x1.00ed447d3903fp-51, 0x1.ff859c118d56cp-52,
+                0x1.fd360d22fc6b3p-52, 0x1.faebb187101b9p-52,
+                0x1.f8a6604897648p-52, 0x1.f665f20c8dffap-52,
+                0x1.f42a40fb72bccp-52, 0x1.f1f328ac2314bp-52,
+                0x1.efc086101ca9fp-52, 0x1.ed923761084fbp-52,
+                0x1.eb681c0f74c95p-52, 0x1.e94214b2a9c61p-52,
+                0x1.e72002f97db46p-52, 0x1.e501c99c1ae74p-52,
+                0x1.e2e74c4ea23acp-52, 0x1.e0d06fb49ae9cp-52,
+                0x1.debd195520a81p-52, 0x1.dcad2f8fc2523p-52,
+                0x1.daa0999204a4fp-52, 0x1.d8973f4d7d74ep-52,
+                0x1.d691096e7cc96p-52, 0x1.d48de1533a183p-52,
+                0x1.d28db1037ca25p-52, 0x1.d0906328b6a3bp-52,
+                0x1.ce95e3068baccp-52, 0x1.cc9e1c73bb0ecp-52,
+                0x1.caa8fbd367ccfp-52, 0x1.c8b66e0eb8002p-52,
+                0x1.c6c6608ec60b7p-52, 0x1.c4d8c136de695p-52,
+                0x1.c2ed7e5f0536bp-52, 0x1.c10486cebefa3p-52,
+                0x1.bf1dc9b81874bp-52, 0x1.bd3936b2e9930p-52,
+                0x1.bb56bdb84fdc0p-52, 0x1.b9764f1e5cf53p-52,
+                0x1.b797db93f6102p-52, 0x1.b5bb541ce14a1p-52,
+                0x1.b3e0aa0dfe361p-52, 0x1.b207cf09a6f7ep-52,
+                0x1.b030b4fc377ffp-52, 0x1.ae5b4e18b89ddp-52,
+                0x1.ac878cd5acc36p-52, 0x1.aab563e9fc731p-52,
+                0x1.a8e4c64a00726p-52, 0x1.a715a724a7f4dp-52,
+                0x1.a547f9e0b90f0p-52, 0x1.a37bb21a29d82p-52,
+                0x1.a1b0c39f90b77p-52, 0x1.9fe7226faa6ecp-52,
+                0x1.9e1ec2b6f486fp-52, 0x1.9c5798cd5ad45p-52,
+                0x1.9a919933f6d93p-52, 0x1.98ccb892dfdc0p-52,
+                0x1.9708ebb70a937p-52, 0x1.954627903758dp-52,
+                0x1.9384612eeddb8p-52, 0x1.91c38dc2855bbp-52,
+                0x1.9003a297387bbp-52, 0x1.8e44951443c09p-52,
+                0x1.8c865aba0de34p-52, 0x1.8ac8e92059191p-52,
+                0x1.890c35f47c82fp-52, 0x1.875036f7a4f7bp-52,
+                0x1.8594e1fd1c625p-52, 0x1.83da2ce896f2fp-52,
+                0x1.82200dac85642p-52, 0x1.80667a486b99bp-52,
+                0x1.7ead68c73ae13p-52, 0x1.7cf4cf3daf1d6p-52,
+                0x1.7b3ca3c8ae292p-52, 0x1.7984dc8ba8bc9p-52,
+                0x1.77cd6faefc22bp-52, 0x1.7616535e540acp-52,
+                0x1.745f7dc70bc12p-52, 0x1.72a8e5168e1a6p-52,
+                0x1.70f27f78b3573p-52, 0x1.6f3c43161c483p-52,
+                0x1.6d86261289f27p-52, 0x1.6bd01e8b30f34p-52,
+                0x1.6a1a229507dcep-52, 0x1.6864283b0fbf5p-52,
+                0x1.66ae257c960d1p-52, 0x1.64f8104b6f00ap-52,
+                0x1.6341de8a27a3fp-52, 0x1.618b860a2e8fdp-52,
+                0x1.5fd4fc89f270dp-52, 0x1.5e1e37b2f5543p-52,
+                0x1.5c672d17d3b46p-52, 0x1.5aafd2323e2f8p-52,
+                0x1.58f81c60e4c49p-52, 0x1.574000e552641p-52,
+                0x1.558774e1b7923p-52, 0x1.53ce6d56a2c3cp-52,
+                0x1.5214df20a50d7p-52, 0x1.505abef5e1a6bp-52,
+                0x1.4ea0016386a9ap-52, 0x1.4ce49acb2d5fbp-52,
+                0x1.4b287f6020504p-52, 0x1.496ba3248525cp-52,
+                0x1.47adf9e6685e7p-52, 0x1.45ef773ca8990p-52,
+                0x1.44300e83bf257p-52, 0x1.426fb2da6358ep-52,
+                0x1.40ae571e05f20p-52, 0x1.3eebede721aa8p-52,
+                0x1.3d2869855dd7dp-52, 0x1.3b63bbfb7fc13p-52,
+                0x1.399dd6fb270e6p-52, 0x1.37d6abe05165ap-52,
+                0x1.360e2baca1031p-52, 0x1.3444470261b66p-52,
+                0x1.3278ee1f4755cp-52, 0x1.30ac10d6e0466p-52,
+                0x1.2edd9e8cb647cp-52, 0x1.2d0d862e1729ep-52,
+                0x1.2b3bb62b7e87dp-52, 0x1.29681c7199014p-52,
+                0x1.2792a661d8bcap-52, 0x1.25bb40ca92395p-52,
+                0x1.23e1d7de97a03p-52, 0x1.2206572c47d13p-52,
+                0x1.2028a9940560cp-52, 0x1.1e48b93e088d8p-52,
+                0x1.1c666f8f7deafp-52, 0x1.1a81b51ee209fp-52,
+                0x1.189a71a788c7ap-52, 0x1.16b08bfc3d18ep-52,
+                0x1.14c3e9f8e41d5p-52, 0x1.12d470730bf72p-52,
+                0x1.10e203294c4bap-52, 0x1.0eec84b15b64bp-52,
+                0x1.0cf3d664b796bp-52, 0x1.0af7d84bc0d04p-52,
+                0x1.08f8690719efbp-52, 0x1.06f565b7249f7p-52,
+                0x1.04eea9e164ed2p-52, 0x1.02e40f5393757p-52,
+                0x1.00d56e041db86p-52, 0x1.fd8537df9798bp-53,
+                0x1.f956d9e872025p-53, 0x1.f51f654d83c82p-53,
+                0x1.f0de784efa58ep-53, 0x1.ec93abdf8c38ep-53,
+                0x1.e83e93379ad00p-53, 0x1.e3debb5d22925p-53,
+                0x1.df73aa9f0ae86p-53, 0x1.dafce0022ede7p-53,
+                0x1.d679d29e35105p-53, 0x1.d1e9f0e7fe5eep-53,
+                0x1.cd4c9fe7151c2p-53, 0x1.c8a13a5316303p-53,
+                0x1.c3e70f95872d9p-53, 0x1.bf1d62abea234p-53,
+                0x1.ba4368e51bb28p-53, 0x1.b5584874191d3p-53,
+                0x1.b05b16d127fcep-53, 0x1.ab4ad6e0f24b2p-53,
+                0x1.a62676d76d6eep-53, 0x1.a0eccdca3ab90p-53,
+                0x1.9b9c98e37c433p-53, 0x1.96347822b180fp-53,
+                0x1.90b2ea94dc29fp-53, 0x1.8b1649e7a6323p-53,
+                0x1.855cc5341f01ap-53, 0x1.7f845ad45d38cp-53,
+                0x1.798ad10b200e6p-53, 0x1.736dad345c6aap-53,
+                0x1.6d2a291feca67p-53, 0x1.66bd261a23772p-53,
+                0x1.60231cfd82f8ep-53, 0x1.59580a70673bcp-53,
+                0x1.5257562196c0fp-53, 0x1.4b1bb363c897fp-53,
+                0x1.439ef8dfe16fcp-53, 0x1.3bd9ec1a11bf7p-53,
+                0x1.33c3fc055e9ddp-53, 0x1.2b52e38621b20p-53,
+                0x1.227a28f78455bp-53, 0x1.192a6973f44f9p-53,
+                0x1.0f5053b004b3ep-53, 0x1.04d32278c831cp-53,
+                0x1.f32482d480781p-54, 0x1.dac2f5a6f30f7p-54,
+                0x1.c004d2f328d65p-54, 0x1.a230c2e46386bp-54,
+                0x1.801fce827fa88p-54, 0x1.57cb9383ae505p-54,
+                0x1.250af3c200a08p-54, 0x1.b8d0be3d697e9p-55
+        },
+        .f = {
+                0x1.f4a946f0d1de8p-12, 0x1.4a605b6b9f70dp-10,
+                0x1.55f9f43c1d642p-9, 0x1.08a1f03b0d9d6p-8,
+                0x1.69ea8d90cf659p-8, 0x1.ce160f8ecbd46p-8,
+                0x1.1a59229956608p-7, 0x1.4eb96421b129fp-7,
+                0x1.841040d8df3c7p-7, 0x1.ba48d274febd6p-7,
+                0x1.f152a4f734692p-7, 0x1.1490334606b66p-6,
+                0x1.30d388daba030p-6, 0x1.4d6eaf2fbf963p-6,
+                0x1.6a5daf40c0f83p-6, 0x1.879d1b6011823p-6,
+                0x1.a529f4e234a40p-6, 0x1.c301983cd6ea9p-6,
+                0x1.e121adb82f964p-6, 0x1.ff881d7191a2bp-6,
+                0x1.0f1982e96be0dp-5, 0x1.1e9059f1fac8ep-5,
+                0x1.2e27ce83e3a4bp-5, 0x1.3ddf2ce993866p-5,
+                0x1.4db5d0e1174f0p-5, 0x1.5dab23cf2ff63p-5,
+                0x1.6dbe9b39925fdp-5, 0x1.7defb77af80cap-5,
+                0x1.8e3e02a691373p-5, 0x1.9ea90f929b752p-5,
+                0x1.af3079038c591p-5, 0x1.bfd3e0f289489p-5,
+                0x1.d092efeae6004p-5, 0x1.e16d547b2c474p-5,
+                0x1.f262c2b6ce57bp-5, 0x1.01b979e31226ap-4,
+                0x1.0a4ed2c15d62bp-4, 0x1.12f14d0f259e1p-4,
+                0x1.1ba0cbe97ce01p-4, 0x1.245d344dd5456p-4,
+                0x1.2d266cf9b7a1cp-4, 0x1.35fc5e4d989c5p-4,
+                0x1.3edef2326e82ep-4, 0x1.47ce1401b7216p-4,
+                0x1.50c9b06fa7e0ap-4, 0x1.59d1b5774bb5cp-4,
+                0x1.62e612485a434p-4, 0x1.6c06b7369a3d2p-4,
+                0x1.753395aaa6d68p-4, 0x1.7e6ca013f4e39p-4,
+                0x1.87b1c9dbf892ap-4, 0x1.9103075a503ffp-4,
+                0x1.9a604dc9dc0ecp-4, 0x1.a3c9933eacae1p-4,
+                0x1.ad3ece9cb6118p-4, 0x1.b6bff78f34fa7p-4,
+                0x1.c04d0680b801dp-4, 0x1.c9e5f493be6b0p-4,
+                0x1.d38abb9be0725p-4, 0x1.dd3b561776076p-4,
+                0x1.e6f7bf29b1fd8p-4, 0x1.f0bff29528b53p-4,
+                0x1.fa93ecb6ba219p-4, 0x1.0239d5406be7bp-3,
+                0x1.072f94bb90233p-3, 0x1.0c2b33d524dc8p-3,
+                0x1.112cb1da2b429p-3, 0x1.16340e5a87438p-3,
+                0x1.1b4149275c57ep-3, 0x1.20546251885dbp-3,
+                0x1.256d5a283a9c9p-3, 0x1.2a8c3137a539cp-3,
+                0x1.2fb0e847c7857p-3, 0x1.34db805b4faefp-3,
+                0x1.3a0bfaae928cbp-3, 0x1.3f4258b698405p-3,
+                0x1.447e9c203c9a8p-3, 0x1.49c0c6cf62380p-3,
+                0x1.4f08dade37697p-3, 0x1.5456da9c8c090p-3,
+                0x1.59aac88f37750p-3, 0x1.5f04a76f8df65p-3,
+                0x1.64647a2ae4e94p-3, 0x1.69ca43e2250e1p-3,
+                0x1.6f3607e96a72ap-3, 0x1.74a7c9c7b174dp-3,
+                0x1.7a1f8d369065fp-3, 0x1.7f9d5621fd64ap-3,
+                0x1.852128a8200abp-3, 0x1.8aab09192e96dp-3,
+                0x1.903afbf75641ep-3, 0x1.95d105f6ae782p-3,
+                0x1.9b6d2bfd36b5dp-3, 0x1.a10f7322decebp-3,
+                0x1.a6b7e0b1996dap-3, 0x1.ac667a2578a15p-3,
+                0x1.b21b452cd44ffp-3, 0x1.b7d647a87a727p-3,
+                0x1.bd9787abe8fd9p-3, 0x1.c35f0b7d9163cp-3,
+                0x1.c92cd99725a0ap-3, 0x1.cf00f8a5eec46p-3,
+                0x1.d4db6f8b2cf90p-3, 0x1.dabc455c81016p-3,
+                0x1.e0a381645f35fp-3, 0x1.e6912b228c089p-3,
+                0x1.ec854a4ca21c4p-3, 0x1.f27fe6cea202bp-3,
+                0x1.f88108cb8bb6bp-3, 0x1.fe88b89e01ed8p-3,
+                0x1.024b7f6c7baf9p-2, 0x1.0555f22433148p-2,
+                0x1.0863b8f908b9ap-2, 0x1.0b74d88b28c34p-2,
+                0x1.0e89559875417p-2, 0x1.11a134fcf6f72p-2,
+                0x1.14bc7bb353ab5p-2, 0x1.17db2ed54a236p-2,
+                0x1.1afd539c33e9ep-2, 0x1.1e22ef618d068p-2,
+                0x1.214c079f81cf6p-2, 0x1.2478a1f182fe7p-2,
+                0x1.27a8c414e0385p-2, 0x1.2adc73e969350p-2,
+                0x1.2e13b77215be7p-2, 0x1.314e94d5b4bc0p-2,
+                0x1.348d125fa2841p-2, 0x1.37cf368086b2fp-2,
+                0x1.3b1507cf19c7bp-2, 0x1.3e5e8d08f2cc0p-2,
+                0x1.41abcd135d51bp-2, 0x1.44fccefc3811cp-2,
+                0x1.485199fadc814p-2, 0x1.4baa35710fb04p-2,
+                0x1.4f06a8ebfcd18p-2, 0x1.5266fc2539c98p-2,
+                0x1.55cb3703d62d5p-2, 0x1.5933619d751c0p-2,
+                0x1.5c9f843772674p-2, 0x1.600fa7481382bp-2,
+                0x1.6383d377c4bacp-2, 0x1.66fc11a2633b0p-2,
+                0x1.6a786ad894729p-2, 0x1.6df8e8612b6eep-2,
+                0x1.717d93ba9cccfp-2, 0x1.7506769c81eb2p-2,
+                0x1.78939af92c0f6p-2, 0x1.7c250aff48404p-2,
+                0x1.7fbad11b949b1p-2, 0x1.8354f7faa7fc9p-2,
+                0x1.86f38a8accdf9p-2, 0x1.8a9693fdf0621p-2,
+                0x1.8e3e1fcba6708p-2, 0x1.91ea39b344265p-2,
+                0x1.959aedbe11841p-2, 0x1.9950484193ad9p-2,
+                0x1.9d0a55e1f0f59p-2, 0x1.a0c9239470123p-2,
+                0x1.a48cbea213ea2p-2, 0x1.a85534aa55846p-2,
+                0x1.ac2293a5fdbdap-2, 0x1.aff4e9ea2080ap-2,
+                0x1.b3cc462b3b601p-2, 0x1.b7a8b780798d6p-2,
+                0x1.bb8a4d671f4d2p-2, 0x1.bf7117c61f2e3p-2,
+                0x1.c35d26f1db714p-2, 0x1.c74e8bb0163b8p-2,
+                0x1.cb45573c135d1p-2, 0x1.cf419b4aeea95p-2,
+                0x1.d3436a102a14bp-2, 0x1.d74ad642770a5p-2,
+                0x1.db57f320bead0p-2, 0x1.df6ad4776cfdbp-2,
+                0x1.e3838ea60330fp-2, 0x1.e7a236a4f5d0ep-2,
+                0x1.ebc6e20bdba61p-2, 0x1.eff1a717f2c6ap-2,
+                0x1.f4229cb301998p-2, 0x1.f859da7a9a145p-2,
+                0x1.fc9778c7c5ff9p-2, 0x1.006dc85b91ce2p-1,
+                0x1.02931e18bd53dp-1, 0x1.04bbcafa69338p-1,
+                0x1.06e7dccf0913bp-1, 0x1.091761d99b386p-1,
+                0x1.0b4a68d7130b6p-1, 0x1.0d81010419aafp-1,
+                0x1.0fbb3a232b22dp-1, 0x1.11f9248317961p-1,
+                0x1.143ad105f04d9p-1, 0x1.168051286962fp-1,
+                0x1.18c9b709b99c2p-1, 0x1.1b17157402fa5p-1,
+                0x1.1d687fe54f923p-1, 0x1.1fbe0a992f705p-1,
+                0x1.2217ca9305a07p-1, 0x1.2475d5a913ecfp-1,
+                0x1.26d8429056974p-1, 0x1.293f28e9432ddp-1,
+                0x1.2baaa14d7fc59p-1, 0x1.2e1ac55eaa44bp-1,
+                0x1.308fafd64a2a1p-1, 0x1.33097c970a544p-1,
+                0x1.358848bf5bd5ap-1, 0x1.380c32bda6eb1p-1,
+                0x1.3a955a6633c5bp-1, 0x1.3d23e10afa26ap-1,
+                0x1.3fb7e9958cdcbp-1, 0x1.425198a35d3b7p-1,
+                0x1.44f114a49abe2p-1, 0x1.479685fdfc719p-1,
+                0x1.4a42172dccb28p-1, 0x1.4cf3f4f49c922p-1,
+                0x1.4fac4e8213288p-1, 0x1.526b55a65eac0p-1,
+                0x1.55313f08e1e08p-1, 0x1.57fe4264d0f35p-1,
+                0x1.5ad29acc8e020p-1, 0x1.5dae86f4b8502p-1,
+                0x1.609249880ae0ep-1, 0x1.637e2985595e3p-1,
+                0x1.667272a936f22p-1, 0x1.696f75e51c96fp-1,
+                0x1.6c7589e63eb2ap-1, 0x1.6f850baeb0e00p-1,
+                0x1.729e5f44002acp-1, 0x1.75c1f07717092p-1,
+                0x1.78f033ca14bcep-1, 0x1.7c29a779d062cp-1,
+                0x1.7f6ed4b21839ap-1, 0x1.82c050f57735bp-1,
+                0x1.861ebfc3863dcp-1, 0x1.898ad48bb89a0p-1,
+                0x1.8d0554fe6b8e2p-1, 0x1.908f1bd322359p-1,
+                0x1.94291c21c3059p-1, 0x1.97d465762351bp-1,
+                0x1.9b9228d24c56ap-1, 0x1.9f63bee65e3a1p-1,
+                0x1.a34aafdf67813p-1, 0x1.a748bd551988bp-1,
+                0x1.ab5fef17af9cep-1, 0x1.af92a3f6dc41bp-1,
+                0x1.b3e3a8235bfe1p-1, 0x1.b85653a90e048p-1,
+                0x1.bceeb4ee2d095p-1, 0x1.c1b1cd9efb94fp-1,
+                0x1.c6a5eceaa82c0p-1, 0x1.cbd33a8a8460bp-1,
+                0x1.d144978a24292p-1, 0x1.d70920658fa1cp-1,
+                0x1.dd36fa7063604p-1, 0x1.e3f11e0296bbep-1,
+                0x1.eb7545b6e5a3ap-1, 0x1.f446ac97c0275p-1,
+                0x1.0000000000000p+0
+        },
+};
+
+const isaac_ziggurat_t isaac_ziggurat_exponential = {
+        .r = 7.69711747013104972,
+        .k = {
+                0xE290A13924BE3ULL, 0xE6DA6ECF27460ULL, 0xEEEFB15D605D8ULL,
+                0xF2CB0E3C5933EULL, 0xF51530F0916D8ULL, 0xF69C650C40A8FULL,
+                0xF7B577D2BE5F3ULL, 0xF889F023D820AULL, 0xF930A1A281A05ULL,
+                0xF9B72D1C52CD1ULL, 0xFA263B32E37EDULL, 0xFA839276708B9ULL,
+                0xFAD334827F1E2ULL, 0xFB18000547133ULL, 0xFB5411A5B9A95ULL,
+                0xFB890078D120EULL, 0xFBB8051AC1566ULL, 0xFBE213C1CF493ULL,
+                0xFC07EE19B01CDULL, 0xFC2A2FC826DC7ULL, 0xFC4957623CB03ULL,
+                0xFC65CCF39C2FCULL, 0xFC7FE6D4D720EULL, 0xFC97ED4E778F9ULL,
+                0xFCAE1D5E81FBCULL, 0xFCC2AADBC17DCULL, 0xFCD5C220AD5E2ULL,
+                0xFCE7895BCFCDEULL, 0xFCF8219B5DF05ULL, 0xFD07A7A3EF98AULL,
+                0xFD16349E2E04AULL, 0xFD23DEA45F500ULL, 0xFD30B9368F90AULL,
+                0xFD3CD59A8469EULL, 0xFD48432B7B351ULL, 0xFD530F9CCFF94ULL,
+                0xFD5D473200305ULL, 0xFD66F4EDF96B9ULL, 0xFD7022BB3F082ULL,
+                0xFD78D98E23CD3ULL, 0xFD812182170E1ULL, 0xFD8901F2D4B02ULL,
+                0xFD90819221429ULL, 0xFD97A67A9CE1FULL, 0xFD9E76401F3A3ULL,
+                0xFDA4F5FDFB4E9ULL, 0xFDAB2A6379BF0ULL, 0xFDB117BECB4A1ULL,
+                0xFDB6C206AAACAULL, 0xFDBC2CE2DC4AEULL, 0xFDC15BB3B2DAAULL,
+                0xFDC65198BA50BULL, 0xFDCB1176A55FEULL, 0xFDCF9DFC95B0CULL,
+                0xFDD3F9A8D3856ULL, 0xFDD826CD068C6ULL, 0xFDDC2791FF351ULL,
+                0xFDDFFDFB1DBD5ULL, 0xFDE3ABE9626F2ULL, 0xFDE7331E3100DULL,
+                0xFDEA953DCFC13ULL, 0xFDEDD3D1AA204ULL, 0xFDF0F04A5D30AULL,
+                0xFDF3EC0193EEDULL, 0xFDF6C83BB8663ULL, 0xFDF986297E305ULL,
+                0xFDFC26E94A447ULL, 0xFDFEAB887B95CULL, 0xFE011504979B2ULL,
+                0xFE03644C5D7F8ULL, 0xFE059A40C26D2ULL, 0xFE07B7B5D920AULL,
+                0xFE09BD73A6B5BULL, 0xFE0BAC36E6688ULL, 0xFE0D84B1BDD9EULL,
+                0xFE0F478C633ABULL, 0xFE10F565B69CFULL, 0xFE128ED3CF8B2ULL,
+                0xFE1414647FE78ULL, 0xFE15869DCCFCFULL, 0xFE16E5FE5F931ULL,
+                0xFE1832FDEBC44ULL, 0xFE196E0D9140CULL, 0xFE1A9798349B8ULL,
+                0xFE1BB002D22C9ULL, 0xFE1CB7ACCB0A6ULL, 0xFE1DAEF02C8DAULL,
+                0xFE1E9621F2C9EULL, 0xFE1F6D92465B1ULL, 0xFE20358CB5DFBULL,
+                0xFE20EE586B707ULL, 0xFE2198385E5CCULL, 0xFE22336B81710ULL,
+                0xFE22C02CEE01BULL, 0xFE233EB40BF41ULL, 0xFE23AF34B6F73ULL,
+                0xFE2411DF611BDULL, 0xFE2466E132F60ULL, 0xFE24AE64296FAULL,
+                0xFE24E88F316F1ULL, 0xFE2515864173AULL, 0xFE25356A71450ULL,
+                0xFE25485A0FD1AULL, 0xFE254E70B754FULL, 0xFE2547C75FDC6ULL,
+                0xFE253474703FEULL, 0xFE25148BCDA19ULL, 0xFE24E81EE9858ULL,
+                0xFE24AF3CCE90DULL, 0xFE2469F22BFFBULL, 0xFE2418495FDDCULL,
+                0xFE23BA4A800D9ULL, 0xFE234FFB62282ULL, 0xFE22D95FA23F4ULL,
+                0xFE225678A8895ULL, 0xFE21C745ADFE3ULL, 0xFE212BC3BFEB4ULL,
+                0xFE2083EDC2830ULL, 0xFE1FCFBC726D4ULL, 0xFE1F0F26655A0ULL,
+                0xFE1E4220099A4ULL, 0xFE1D689BA4BFDULL, 0xFE1C828951443ULL,
+                0xFE1B8FD6FB37CULL, 0xFE1A90705BF63ULL, 0xFE19843EF4E07ULL,
+                0xFE186B2A09176ULL, 0xFE1745169635AULL, 0xFE1611E74C023ULL,
+                0xFE14D17C83187ULL, 0xFE1383B4327E1ULL, 0xFE122869E41FFULL,
+                0xFE10BF76A82EFULL, 0xFE0F48B107521ULL, 0xFE0DC3ECF3A5AULL,
+                0xFE0C30FBB87A5ULL, 0xFE0A8FABE8CA1ULL, 0xFE08DFC94C532ULL,
+                0xFE07211CCB4C5ULL, 0xFE05536C58A13ULL, 0xFE03767ADAA59ULL,
+                0xFE018A08122C4ULL, 0xFDFF8DD07FED8ULL, 0xFDFD818D48262ULL,
+                0xFDFB64F414571ULL, 0xFDF937B6F30BAULL, 0xFDF6F98435894ULL,
+                0xFDF4AA064B4AFULL, 0xFDF248E39B26FULL, 0xFDEFD5BE59FA0ULL,
+                0xFDED50345EB35ULL, 0xFDEAB7DEF394EULL, 0xFDE80C52A47CFULL,
+                0xFDE54D1F0A06AULL, 0xFDE279CE914CAULL, 0xFDDF91E64014FULL,
+                0xFDDC94E575271ULL, 0xFDD98245A48A2ULL, 0xFDD6597A0F60BULL,
+                0xFDD319EF77143ULL, 0xFDCFC30BCB793ULL, 0xFDCC542DD3902ULL,
+                0xFDC8CCACD07BAULL, 0xFDC52BD81A3FBULL, 0xFDC170F6B5D04ULL,
+                0xFDBD9B46E3ED4ULL, 0xFDB9A9FDA83CCULL, 0xFDB59C4648085ULL,
+                0xFDB17141BFF2CULL, 0xFDAD28062FED5ULL, 0xFDA8BF9E3C9FEULL,
+                0xFDA437086566BULL, 0xFD9F8D364DF06ULL, 0xFD9AC10BFA70CULL,
+                0xFD95D15EFD425ULL, 0xFD90BCF594B1DULL, 0xFD8B8285B78FDULL,
+                0xFD8620B40EFFAULL, 0xFD809612DBD09ULL, 0xFD7AE120C583FULL,
+                0xFD75004790EB6ULL, 0xFD6EF1DABC160ULL, 0xFD68B415FCFF4ULL,
+                0xFD62451BA02C2ULL, 0xFD5BA2F2C4119ULL, 0xFD54CB856DC2CULL,
+                0xFD4DBC9E72FF7ULL, 0xFD4673E73543AULL, 0xFD3EEEE528F62ULL,
+                0xFD372AF7233C1ULL, 0xFD2F2552684BEULL, 0xFD26DAFF73551ULL,
+                0xFD1E48D670341ULL, 0xFD156B7B5E27EULL, 0xFD0C3F59D199CULL,
+                0xFD02C0A049B60ULL, 0xFCF8EB3B0D0E7ULL, 0xFCEEBACE7EC01ULL,
+                0xFCE42AB0DB8BDULL, 0xFCD935E34BF80ULL, 0xFCCDD70A35D40ULL,
+                0xFCC20864B4449ULL, 0xFCB5C3C319C49ULL, 0xFCA9027C5B26DULL,
+                0xFC9BBD623D7ECULL, 0xFC8DECB41AC70ULL, 0xFC7F881009F0BULL,
+                0xFC7086622E825ULL, 0xFC60DDD1E9CD6ULL, 0xFC5083AC9BA7DULL,
+                0xFC3F6C4D92131ULL, 0xFC2D8B02B5C89ULL, 0xFC1AD1ED6C8B1ULL,
+                0xFC0731DF1089CULL, 0xFBF29A303CFC5ULL, 0xFBDCF89209FFAULL,
+                0xFBC638D822E60ULL, 0xFBAE44BA684EBULL, 0xFB95038C8789DULL,
+                0xFB7A59E99727AULL, 0xFB5E295158173ULL, 0xFB404FB42CB3CULL,
+                0xFB20A6EA22BB9ULL, 0xFAFF041086846ULL, 0xFADB36C84CCCBULL,
+                0xFAB5084E1F660ULL, 0xFA8C3A62E1991ULL, 0xFA6085F8E9D07ULL,
+                0xFA319996BC47DULL, 0xF9FF175B734A6ULL, 0xF9C8928ABE083ULL,
+                0xF98D8C7DCAA99ULL, 0xF94D70CA8D43AULL, 0xF9079062292B8ULL,
+                0xF8BB1B4F8FBBDULL, 0xF867189D3CB5BULL, 0xF80A5BB6EEA52ULL,
+                0xF7A37651B0E68ULL, 0xF730A57372B44ULL, 0xF6AFB7843CCE7ULL,
+                0xF61DE83DA32ABULL, 0xF577AD8A7784FULL, 0xF4B86D784571FULL,
+                0xF3DA104B78236ULL, 0xF2D458BBE5BD1ULL, 0xF19BDB8EA3C1BULL,
+                0xF0204EFD64EE5ULL, 0xEE49A6E8B9638ULL, 0xEBF2DEAB58C59ULL,
+                0xE8DFF16AE1CB9ULL, 0xE4A8E87C4328DULL, 0xDE893FB8CA23EULL,
+                0xD4DDB99075857ULL, 0xC377AC71F9E08ULL, 0x9BEADEBCE18C1ULL,
+                0x0000000000000ULL
+        },
+        .w = {
+                0x1.164ec94bf5dc1p-49, 0x1.ec9d9297ebb83p-50,
+                0x1.bc39e51da71fcp-50, 0x1.9e9dc0d487b85p-50,
+                0x1.8939fe6f2ed19p-50, 0x1.78750d6eac62fp-50,
+                0x1.6aa676d4bbf72p-50, 0x1.5ee7ae17313d2p-50,
+                0x1.54ad83ccf73f6p-50, 0x1.4b9d7cd4751d1p-50,
+                0x1.4379766e41362p-50, 0x1.3c14ec7c8b861p-50,
+                0x1.354ee27ccf75ep-50, 0x1.2f0e38a4411f0p-50,
+                0x1.293f5ae49aaa5p-50, 0x1.23d2bb659919fp-50,
+                0x1.1ebbca0c9fa7cp-50, 0x1.19f03bcb3c2d6p-50,
+                0x1.156786775442ap-50, 0x1.111a8034392a6p-50,
+                0x1.0d031785d48a0p-50, 0x1.091c1cdcba54ep-50,
+                0x1.056118bf58eefp-50, 0x1.01ce2b362ec2ep-50,
+                0x1.fcbfe43f6c6e5p-51, 0x1.f626e9791f7a7p-51,
+                0x1.efcc26750ea4ap-51, 0x1.e9aaf2af383c1p-51,
+                0x1.e3bf26e190960p-51, 0x1.de050af4ef19fp-51,
+                0x1.d87946fec3becp-51, 0x1.d318d6b2738c5p-51,
+                0x1.cde0fecf2a97fp-51, 0x1.c8cf442c8c8f4p-51,
+                0x1.c3e1641c2e0a7p-51, 0x1.bf154de4bef77p-51,
+                0x1.ba691d276da5ep-51, 0x1.b5db15091ea0fp-51,
+                0x1.b1699c003b60ap-51, 0x1.ad13382d845c4p-51,
+                0x1.a8d68c2ad86eap-51, 0x1.a4b2543e84c3bp-51,
+                0x1.a0a563e49f178p-51, 0x1.9caea3a24d9eap-51,
+                0x1.98cd0f18d1ad8p-51, 0x1.94ffb34fc2a0ep-51,
+                0x1.9145ad2f37544p-51, 0x1.8d9e2823b3695p-51,
+                0x1.8a085ce695babp-51, 0x1.8683906687342p-51,
+                0x1.830f12cc0bec3p-51, 0x1.7faa3e96e1412p-51,
+                0x1.7c5477d1476d3p-51, 0x1.790d2b56b71f9p-51,
+                0x1.75d3ce2bd71c3p-51, 0x1.72a7dce5cd218p-51,
+                0x1.6f88db1f42507p-51, 0x1.6c7652f9a7b1ep-51,
+                0x1.696fd4a9748eep-51, 0x1.6674f60c3f432p-51,
+                0x1.63855247b2e94p-51, 0x1.60a0897081879p-51,
+                0x1.5dc640388bd9ep-51, 0x1.5af61fa38e107p-51,
+                0x1.582fd4c1b4461p-51, 0x1.5573106f8a75ap-51,
+                0x1.52bf871acaab2p-51, 0x1.5014f08b99508p-51,
+                0x1.4d7307b1cb127p-51, 0x1.4ad98a75da14cp-51,
+                0x1.4848398d39432p-51, 0x1.45bed851bc92cp-51,
+                0x1.433d2c9bd42f8p-51, 0x1.40c2fe9f5eeadp-51,
+                0x1.3e5018cadded0p-51, 0x1.3be447a8d8b83p-51,
+                0x1.397f59c345143p-51, 0x1.37211f88ca857p-51,
+                0x1.34c96b33bc965p-51, 0x1.327810b2aa7d0p-51,
+                0x1.302ce59265965p-51, 0x1.2de7c0e962d70p-51,
+                0x1.2ba87b445db51p-51, 0x1.296eee942532bp-51,
+                0x1.273af61c7daa6p-51, 0x1.250c6e6403bbap-51,
+                0x1.22e33524fe550p-51, 0x1.20bf293f0f4a2p-51,
+                0x1.1ea02aa9b3370p-51, 0x1.1c861a6782a5ap-51,
+                0x1.1a70da7a27820p-51, 0x1.18604dd6fae9ep-51,
+                0x1.1654585c404c1p-51, 0x1.144cdec6f3a2bp-51,
+                0x1.1249c6a92154ap-51, 0x1.104af660befcep-51,
+                0x1.0e50550efcfb7p-51, 0x1.0c59ca900946fp-51,
+                0x1.0a673f733c819p-51, 0x1.08789cf3aad0fp-51,
+                0x1.068dccf1126dbp-51, 0x1.04a6b9e9224a3p-51,
+                0x1.02c34ef11391bp-51, 0x1.00e377af911d4p-51,
+                0x1.fe0e40add09d8p-52, 0x1.fa5c6b3efe1e5p-52,
+                0x1.f6b1498515ed0p-52, 0x1.f30cb6ea0bc7fp-52,
+                0x1.ef6e8fc5b9168p-52, 0x1.ebd6b154a7678p-52,
+                0x1.e844f9af4237fp-52, 0x1.e4b947c16a452p-52,
+                0x1.e1337b426509cp-52, 0x1.ddb374ad2357fp-52,
+                0x1.da391538da50ap-52, 0x1.d6c43ed1ea3ffp-52,
+                0x1.d354d4130f2adp-52, 0x1.cfeab83ed7180p-52,
+                0x1.cc85cf395a56cp-52, 0x1.c925fd82323fbp-52,
+                0x1.c5cb282eab1a4p-52, 0x1.c27534e42e02dp-52,
+                0x1.bf2409d2dfd85p-52, 0x1.bbd78db072610p-52,
+                0x1.b88fa7b324fb6p-52, 0x1.b54c3f8cf2542p-52,
+                0x1.b20d3d66e8bb5p-52, 0x1.aed289dcaacffp-52,
+                0x1.ab9c0df81657ap-52, 0x1.a869b32d0f30fp-52,
+                0x1.a53b63556c690p-52, 0x1.a21108ad0592dp-52,
+                0x1.9eea8dcdde951p-52, 0x1.9bc7ddac7035dp-52,
+                0x1.98a8e3940bbf4p-52, 0x1.958d8b235828ap-52,
+                0x1.9275c048e73e1p-52, 0x1.8f616f3fe1513p-52,
+                0x1.8c50848cc6094p-52, 0x1.8942ecfa40f54p-52,
+                0x1.86389596108e7p-52, 0x1.83316badfe62ap-52,
+                0x1.802d5ccce7277p-52, 0x1.7d2c56b7d17f7p-52,
+                0x1.7a2e476b1240ap-52, 0x1.77331d177d130p-52,
+                0x1.743ac61fa041cp-52, 0x1.714531150a9fbp-52,
+                0x1.6e524cb59a608p-52, 0x1.6b6207e8d3cdfp-52,
+                0x1.687451bd3ebeep-52, 0x1.65891965c9b8cp-52,
+                0x1.62a04e3731a2ep-52, 0x1.5fb9dfa56cf26p-52,
+                0x1.5cd5bd4119335p-52, 0x1.59f3d6b4e9cf9p-52,
+                0x1.57141bc316f27p-52, 0x1.54367c42cb5f8p-52,
+                0x1.515ae81d900fbp-52, 0x1.4e814f4cb45eap-52,
+                0x1.4ba9a1d6b18a4p-52, 0x1.48d3cfcc883c4p-52,
+                0x1.45ffc94716ca7p-52, 0x1.432d7e6466cd0p-52,
+                0x1.405cdf44f09c4p-52, 0x1.3d8ddc08d336ep-52,
+                0x1.3ac064ccfeffcp-52, 0x1.37f469a851af0p-52,
+                0x1.3529daa8a1ba1p-52, 0x1.3260a7cfb7611p-52,
+                0x1.2f98c11031721p-52, 0x1.2cd2164a53b5dp-52,
+                0x1.2a0c9748bcdaap-52, 0x1.274833bd0189fp-52,
+                0x1.2484db3c2a329p-52, 0x1.21c27d3b10e05p-52,
+                0x1.1f01090a9c4e2p-52, 0x1.1c406dd3d5283p-52,
+                0x1.19809a93d2396p-52, 0x1.16c17e1777ffbp-52,
+                0x1.140306f707dbep-52, 0x1.114523917ac15p-52,
+                0x1.0e87c207a2f66p-52, 0x1.0bcad03710137p-52,
+                0x1.090e3bb4b0072p-52, 0x1.0651f1c7276f8p-52,
+                0x1.0395df60db162p-52, 0x1.00d9f119a3cd9p-52,
+                0x1.fc3c26504a9a1p-53, 0x1.f6c462b57feb5p-53,
+                0x1.f14c6e20294a0p-53, 0x1.ebd41e5e21b62p-53,
+                0x1.e65b483cf1044p-53, 0x1.e0e1bf77c31fep-53,
+                0x1.db6756a429057p-53, 0x1.d5ebdf1d86b8dp-53,
+                0x1.d06f28ef0e6fbp-53, 0x1.caf102bc25adbp-53,
+                0x1.c57139a70d29fp-53, 0x1.bfef99359fe99p-53,
+                0x1.ba6beb33f8f8ap-53, 0x1.b4e5f794c979cp-53,
+                0x1.af5d844f224c9p-53, 0x1.a9d255396d261p-53,
+                0x1.a4442be14884ap-53, 0x1.9eb2c75ff03bfp-53,
+                0x1.991de42ad1338p-53, 0x1.93853bdfda244p-53,
+                0x1.8de8850d0c52ap-53, 0x1.884772f2be1ecp-53,
+                0x1.82a1b53fed599p-53, 0x1.7cf6f7c7e8172p-53,
+                0x1.7746e23077973p-53, 0x1.71911797990bbp-53,
+                0x1.6bd5362faa944p-53, 0x1.6612d6d0c68e0p-53,
+                0x1.60498c7dd2ecfp-53, 0x1.5a78e3db8befdp-53,
+                0x1.54a0629786f4dp-53, 0x1.4ebf86bcd0b93p-53,
+                0x1.48d5c5f35e712p-53, 0x1.42e28ca706749p-53,
+                0x1.3ce53d12162a0p-53, 0x1.36dd2e26d8203p-53,
+                0x1.30c9aa526da4bp-53, 0x1.2aa9ee123680bp-53,
+                0x1.247d26538ff2ep-53, 0x1.1e426e93e49e7p-53,
+                0x1.17f8ceb4bdfa0p-53, 0x1.119f38749f5afp-53,
+                0x1.0b348479b80fcp-53, 0x1.04b76ed6a7558p-53,
+                0x1.fc4d25d683209p-54, 0x1.ef00ccf5f4faap-54,
+                0x1.e186678f1735ap-54, 0x1.d3da24df17c36p-54,
+                0x1.c5f7bd78c3f89p-54, 0x1.b7da5dddda3c4p-54,
+                0x1.a97c8be5d5204p-54, 0x1.9ad80552237d2p-54,
+                0x1.8be5954d3606fp-54, 0x1.7c9cdda17d01ap-54,
+                0x1.6cf40f0a72bbep-54, 0x1.5cdf89d024ac4p-54,
+                0x1.4c515c60bfe22p-54, 0x1.3b388fe3d6ecap-54,
+                0x1.2980290da2633p-54, 0x1.170db24d6f670p-54,
+                0x1.03bf049c65c3cp-54, 0x1.decd8b76dbd99p-55,
+                0x1.b38d1ef79b7cdp-55, 0x1.85090fbc27a81p-55,
+                0x1.522e6e54a2a75p-55, 0x1.19335a95b8dbbp-55,
+                0x1.ad6b2495b4d2ep-56, 0x1.0589d8b5d411dp-56
+        },
+        .f = {
+                0x1.5e5d3f59d055cp-13, 0x1.dc31c329f0b4bp-12,
+                0x1.fb20af78dfcb9p-11, 0x1.92bb5540c3e25p-10,
+                0x1.1946ba8e1a324p-9, 0x1.6d888f3a1feffp-9,
+                0x1.c58b381cd4b11p-9, 0x1.1073d69574043p-8,
+                0x1.3fa97cee322fdp-8, 0x1.7049f37ec3620p-8,
+                0x1.a23e9d4974836p-8, 0x1.d5751fa745dc5p-8,
+                0x1.04ef2295fd7f9p-7, 0x1.1fb69edb37671p-7,
+                0x1.3b0b8c1516f62p-7, 0x1.56e930be416cbp-7,
+                0x1.734b6e6aa74f5p-7, 0x1.902ea688fa7bdp-7,
+                0x1.ad8fa5542c92dp-7, 0x1.cb6b9146e2757p-7,
+                0x1.e9bfdde89c7cep-7, 0x1.04452091e02f0p-6,
+                0x1.13e4554725f5fp-6, 0x1.23bc9e1b93a32p-6,
+                0x1.33cd225315d84p-6, 0x1.44151ce87f0bep-6,
+                0x1.5493da6ab0251p-6, 0x1.6548b72a24077p-6,
+                0x1.76331da87fc96p-6, 0x1.8752853ec9967p-6,
+                0x1.98a670f132a48p-6, 0x1.aa2e6e6924e9bp-6,
+                0x1.bbea150fa5870p-6, 0x1.cdd9054331b0cp-6,
+                0x1.dffae7a517468p-6, 0x1.f24f6c7af9890p-6,
+                0x1.026b2590dfaeep-5, 0x1.0bc7a0c7cd651p-5,
+                0x1.153d09f19b3a1p-5, 0x1.1ecb45ff312d4p-5,
+                0x1.28723c956c00cp-5, 0x1.3231d7e3f14aep-5,
+                0x1.3c0a047ff18ffp-5, 0x1.45fab14266b19p-5,
+                0x1.5003cf296c5ebp-5, 0x1.5a25513c5d2cap-5,
+                0x1.645f2c726a041p-5, 0x1.6eb1579b6af52p-5,
+                0x1.791bcb4ab089ep-5, 0x1.839e81c3a396bp-5,
+                0x1.8e3976e80776dp-5, 0x1.98eca827b7c4cp-5,
+                0x1.a3b81471bf138p-5, 0x1.ae9bbc26a8084p-5,
+                0x1.b997a10bed985p-5, 0x1.c4abc640721e9p-5,
+                0x1.cfd83031e794ap-5, 0x1.db1ce49315810p-5,
+                0x1.e679ea52eb2e5p-5, 0x1.f1ef49944e834p-5,
+                0x1.fd7d0ba699676p-5, 0x1.04919d7f5c817p-4,
+                0x1.0a70f19871b3bp-4, 0x1.105c88756ca50p-4,
+                0x1.165468f755392p-4, 0x1.1c589a86fa340p-4,
+                0x1.22692512c9d8cp-4, 0x1.2886110ce0570p-4,
+                0x1.2eaf676948dd1p-4, 0x1.34e5319c6e718p-4,
+                0x1.3b277999b9f9ep-4, 0x1.417649d25b10ep-4,
+                0x1.47d1ad343985cp-4, 0x1.4e39af290d929p-4,
+                0x1.54ae5b959d036p-4, 0x1.5b2fbed91bb3ep-4,
+                0x1.61bde5ccadef7p-4, 0x1.6858ddc30b620p-4,
+                0x1.6f00b488416b6p-4, 0x1.75b5786193c1ep-4,
+                0x1.7c77380d7a6f3p-4, 0x1.834602c3bc4bap-4,
+                0x1.8a21e835a533bp-4, 0x1.910af88e574b9p-4,
+                0x1.9801447336b70p-4, 0x1.9f04dd046f428p-4,
+                0x1.a615d3dd938b7p-4, 0x1.ad343b1655465p-4,
+                0x1.b460254356548p-4, 0x1.bb99a5771268fp-4,
+                0x1.c2e0cf42e10afp-4, 0x1.ca35b6b80fd57p-4,
+                0x1.d198706914dd7p-4, 0x1.d909116ad9398p-4,
+                0x1.e087af561bafbp-4, 0x1.e8146048eb9ccp-4,
+                0x1.efaf3ae83c33cp-4, 0x1.f758566190414p-4,
+                0x1.ff0fca6cbea8dp-4, 0x1.036ad7a6e7f04p-3,
+                0x1.07550eeb7a5bep-3, 0x1.0b4697b54b62fp-3,
+                0x1.0f3f7efec1720p-3, 0x1.133fd20c9712fp-3,
+                0x1.17479e6f0ae78p-3, 0x1.1b56f2031d666p-3,
+                0x1.1f6ddaf3dca65p-3, 0x1.238c67bbbe878p-3,
+                0x1.27b2a72609940p-3, 0x1.2be0a8504cf34p-3,
+                0x1.30167aabe7d6ep-3, 0x1.34542dffa0cafp-3,
+                0x1.3899d2694d5c9p-3, 0x1.3ce7785f8a905p-3,
+                0x1.413d30b386a9ap-3, 0x1.459b0c92dccc6p-3,
+                0x1.4a011d8983096p-3, 0x1.4e6f7583cb6fap-3,
+                0x1.52e626d078c49p-3, 0x1.57654422e78f5p-3,
+                0x1.5bece0954c2b6p-3, 0x1.607d0fab06a31p-3,
+                0x1.6515e5530d1acp-3, 0x1.69b775ea6da28p-3,
+                0x1.6e61d63ee84eap-3, 0x1.73151b91a2839p-3,
+                0x1.77d15b99f46fep-3, 0x1.7c96ac8851baep-3,
+                0x1.816525094e7e5p-3, 0x1.863cdc48c1af9p-3,
+                0x1.8b1de9f5062d4p-3, 0x1.900866425bb79p-3,
+                0x1.94fc69ee692a1p-3, 0x1.99fa0e43e1623p-3,
+                0x1.9f016d1e4c512p-3, 0x1.a412a0edf5cbcp-3,
+                0x1.a92dc4bc03c49p-3, 0x1.ae52f42eb5b0bp-3,
+                0x1.b3824b8dcef3ep-3, 0x1.b8bbe7c72e4a5p-3,
+                0x1.bdffe67394435p-3, 0x1.c34e65db9afeep-3,
+                0x1.c8a784fce1801p-3, 0x1.ce0b638f6d09fp-3,
+                0x1.d37a220b431fdp-3, 0x1.d8f3e1ae3eeb8p-3,
+                0x1.de78c48224f39p-3, 0x1.e408ed62f83a7p-3,
+                0x1.e9a48005940f2p-3, 0x1.ef4ba0fe8e09bp-3,
+                0x1.f4fe75c963e7ep-3, 0x1.fabd24cff9354p-3,
+                0x1.0043eab93476ap-2, 0x1.032f580797c2cp-2,
+                0x1.0620ef05d90d2p-2, 0x1.0918c4ee93e13p-2,
+                0x1.0c16ef88f5332p-2, 0x1.0f1b852d9a66cp-2,
+                0x1.12269ccba9fbap-2, 0x1.15384dee291efp-2,
+                0x1.1850b0c191982p-2, 0x1.1b6fde19abc5ap-2,
+                0x1.1e95ef77b09dap-2, 0x1.21c2ff10b7effp-2,
+                0x1.24f727d4776fdp-2, 0x1.2832857457629p-2,
+                0x1.2b75346ae2262p-2, 0x1.2ebf520394270p-2,
+                0x1.3210fc6312435p-2, 0x1.356a528fcd0ddp-2,
+                0x1.38cb747b17defp-2, 0x1.3c34830abb285p-2,
+                0x1.3fa5a0230a14ep-2, 0x1.431eeeb1841e2p-2,
+                0x1.46a092b80beefp-2, 0x1.4a2ab158bdad2p-2,
+                0x1.4dbd70e26f91dp-2, 0x1.5158f8dde89f5p-2,
+                0x1.54fd721bda3e7p-2, 0x1.58ab06c3aa9eep-2,
+                0x1.5c61e2631ee6cp-2, 0x1.602231fef5876p-2,
+                0x1.63ec2424827e4p-2, 0x1.67bfe8fc60d9fp-2,
+                0x1.6b9db25e4e99cp-2, 0x1.6f85b3e649e9dp-2,
+                0x1.7378230b08deap-2, 0x1.77753735e72e3p-2,
+                0x1.7b7d29dc6801ep-2, 0x1.7f90369b6ce59p-2,
+                0x1.83ae9b5446138p-2, 0x1.87d8984bc3f8cp-2,
+                0x1.8c0e704b75d39p-2, 0x1.905068c545d04p-2,
+                0x1.949ec9f9a8110p-2, 0x1.98f9df2097ba8p-2,
+                0x1.9d61f695a3792p-2, 0x1.a1d76207521f4p-2,
+                0x1.a65a76aa30140p-2, 0x1.aaeb8d6fdf6e5p-2,
+                0x1.af8b03428ef5fp-2, 0x1.b43939454806fp-2,
+                0x1.b8f6951990b88p-2, 0x1.bdc3812aeeeb5p-2,
+                0x1.c2a06d00ea583p-2, 0x1.c78dcd983fb60p-2,
+                0x1.cc8c1dc40e092p-2, 0x1.d19bde97e1a0ap-2,
+                0x1.d6bd97db9ed7ap-2, 0x1.dbf1d88a7210cp-2,
+                0x1.e139375e137fcp-2, 0x1.e6945367dd351p-2,
+                0x1.ec03d4b969d90p-2, 0x1.f1886d1eb424dp-2,
+                0x1.f722d8ebfc5fap-2, 0x1.fcd3dfe214576p-2,
+                0x1.014e2b160f324p-1, 0x1.043e8ebd26548p-1,
+                0x1.073b931ee3b7dp-1, 0x1.0a45b8854d02ap-1,
+                0x1.0d5d8812b1e2bp-1, 0x1.108394a1cc38cp-1,
+                0x1.13b87bc33169cp-1, 0x1.16fce6dce6feep-1,
+                0x1.1a518c71e3b25p-1, 0x1.1db7319877b89p-1,
+                0x1.212eaba813ec8p-1, 0x1.24b8e228c50a3p-1,
+                0x1.2856d111132bdp-1, 0x1.2c098b61f4f24p-1,
+                0x1.2fd23e345da5ep-1, 0x1.33b23450e6318p-1,
+                0x1.37aada708ddd9p-1, 0x1.3bbdc44e1d114p-1,
+                0x1.3fecb2bb18b7fp-1, 0x1.44399afa8e125p-1,
+                0x1.48a6afb8ee069p-1, 0x1.4d366c151f8aep-1,
+                0x1.51eba1578899ap-1, 0x1.56c9882da8773p-1,
+                0x1.5bd3d694cac75p-1, 0x1.610edc1a7af66p-1,
+                0x1.667fa6d4f5c06p-1, 0x1.6c2c3498418c6p-1,
+                0x1.721bb5ba94b63p-1, 0x1.7856e9b09d47ep-1,
+                0x1.7ee8a2d243126p-1, 0x1.85de87806c5b8p-1,
+                0x1.8d4a376d3d22fp-1, 0x1.95431c455aa39p-1,
+                0x1.9de9715556d9bp-1, 0x1.a76baa562fae7p-1,
+                0x1.b210f0ee67f2ap-1, 0x1.be5007beb7b27p-1,
+                0x1.cd0a65081fff0p-1, 0x1.e0545e5881136p-1,
+                0x1.0000000000000p+0
+        },
+};
@@ -14,7 +14,24 @@ int main(void)
 {
     test_isaac_init();
     test_isaac_next();
+    test_isaac_view();
+    test_isaac_bytes();
     test_isaac_convert();
     test_isaac_cleanup();
+    test_isaac_lanes();
+    test_isaac_kernel();
+    test_isaac_variants();
+    test_isaac_uniform();
+    test_isaac_ziggurat();
+    test_isaac_permute();
+    test_isaac_sample();
+    test_isaac_parallel();
+    test_isaac_buffered();
+    test_isaac_ring();
+    test_isaac_split();
+    test_isaac_snapshot();
+    test_isaac_lean();
+    test_isaac_alloc();
+    test_isaac_pool();
     return atto_at_least_one_fail;
 }
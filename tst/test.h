@@ -21,10 +21,36 @@ extern "C"
 #include <stdio.h>
 #include <inttypes.h>
 
+/** Amount of vector kernels, see #test_kernel_names. */
+#define TEST_KERNELS 5U
+
+/**
+ * Names of all the vector kernels for isaac_kernel_select(), so that the
+ * tests comparing them with the portable one cover every kernel.
+ */
+extern const char* const test_kernel_names[TEST_KERNELS];
+
 void test_isaac_init(void);
 void test_isaac_next(void);
+void test_isaac_view(void);
+void test_isaac_bytes(void);
 void test_isaac_convert(void);
 void test_isaac_cleanup(void);
+void test_isaac_lanes(void);
+void test_isaac_kernel(void);
+void test_isaac_variants(void);
+void test_isaac_uniform(void);
+void test_isaac_ziggurat(void);
+void test_isaac_permute(void);
+void test_isaac_sample(void);
+void test_isaac_parallel(void);
+void test_isaac_buffered(void);
+void test_isaac_ring(void);
+void test_isaac_split(void);
+void test_isaac_snapshot(void);
+void test_isaac_lean(void);
+void test_isaac_alloc(void);
+void test_isaac_pool(void);
 
 #ifdef __cplusplus
 }
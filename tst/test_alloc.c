@@ -0,0 +1,56 @@
+/**
+ * @file
+ *
+ * Test suite of LibISAAC, testing isaac_ctx_new() and isaac_ctx_free().
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "test.h"
+
+#define ALLOC_VALUES 600
+
+static void test_alloc_free_null(void)
+{
+    isaac_ctx_free(NULL);
+}
+
+static void test_alloc_matches_init(void)
+{
+    isaac_ctx_t expected;
+    isaac_uint_t expected_values[ALLOC_VALUES];
+    isaac_uint_t obtained_values[ALLOC_VALUES];
+    const uint8_t seed[5] = {1, 2, 3, 4, 5};
+    isaac_init(&expected, seed, sizeof(seed));
+    isaac_stream(&expected, expected_values, ALLOC_VALUES);
+
+    isaac_ctx_t* const ctx = isaac_ctx_new(seed, sizeof(seed));
+    atto_neq(ctx, NULL);
+    atto_eq((uintptr_t) ctx % ISAAC_CACHE_LINE, 0);
+    isaac_stream(ctx, obtained_values, ALLOC_VALUES);
+    atto_memeq(obtained_values, expected_values, sizeof(expected_values));
+    isaac_ctx_free(ctx);
+}
+
+static void test_alloc_layout(void)
+{
+#if ISAAC_CTX_ALIGNED
+    atto_eq(offsetof(isaac_ctx_t, a), 0);
+    atto_eq(offsetof(isaac_ctx_t, stream_index), 3 * sizeof(isaac_uint_t));
+    atto_eq(offsetof(isaac_ctx_t, result), ISAAC_CACHE_LINE);
+    atto_eq(offsetof(isaac_ctx_t, mem) % ISAAC_CACHE_LINE, 0);
+    atto_eq(_Alignof(isaac_ctx_t), ISAAC_CACHE_LINE);
+    atto_eq(sizeof(isaac_ctx_t) % ISAAC_CACHE_LINE, 0);
+#else
+    atto_eq(offsetof(isaac_ctx_t, result), 0);
+#endif
+}
+
+void test_isaac_alloc(void)
+{
+    test_alloc_free_null();
+    test_alloc_matches_init();
+    test_alloc_layout();
+}
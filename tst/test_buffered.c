@@ -0,0 +1,120 @@
+/**
+ * @file
+ *
+ * Test suite of LibISAAC, testing the double-buffered context.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "test.h"
+#include <string.h>
+
+#define BUFFERED_VALUES (40U * ISAAC_ELEMENTS + 7U)
+
+/**
+ * Reads the stream in chunks of varying length, optionally prefetching
+ * between them.
+ */
+static void buffered_read(isaac_buffered_ctx_t* const bctx,
+                          isaac_uint_t* const values,
+                          const bool prefetching)
+{
+    size_t taken = 0;
+    size_t chunk = 1;
+    while (taken < BUFFERED_VALUES)
+    {
+        if (chunk > BUFFERED_VALUES - taken)
+        {
+            chunk = BUFFERED_VALUES - taken;
+        }
+        isaac_buffered_stream(bctx, &values[taken], chunk);
+        if (prefetching)
+        {
+            isaac_prefetch(bctx);
+        }
+        taken += chunk;
+        chunk = (chunk * 7 + 3) % 700;
+    }
+}
+
+static void test_buffered_null(void)
+{
+    isaac_buffered_ctx_t bctx;
+    isaac_uint_t values[4] = {0};
+    isaac_buffered_init(NULL, NULL, 0);
+    isaac_buffered_stream(NULL, values, 4);
+    isaac_prefetch(NULL);
+    atto_false(isaac_buffered_start(NULL));
+    isaac_buffered_stop(NULL);
+    isaac_buffered_cleanup(NULL);
+    atto_zeros(values, 4);
+
+    isaac_buffered_init(&bctx, NULL, 0);
+    isaac_buffered_stream(&bctx, NULL, 4);
+    isaac_buffered_stop(&bctx);
+    isaac_buffered_cleanup(&bctx);
+    atto_zeros((uint8_t*) &bctx, sizeof(bctx));
+}
+
+static void test_buffered_same_stream(void)
+{
+    static isaac_uint_t expected[BUFFERED_VALUES];
+    static isaac_uint_t obtained[BUFFERED_VALUES];
+    const uint8_t seed[6] = {1, 2, 3, 4, 5, 6};
+    isaac_ctx_t ctx;
+    isaac_buffered_ctx_t bctx;
+    isaac_init(&ctx, seed, sizeof(seed));
+    isaac_stream(&ctx, expected, BUFFERED_VALUES);
+
+    // Generating inline
+    isaac_buffered_init(&bctx, seed, sizeof(seed));
+    buffered_read(&bctx, obtained, false);
+    atto_memeq(obtained, expected, sizeof(expected));
+    isaac_buffered_cleanup(&bctx);
+
+    // Prefetching explicitly
+    memset(obtained, 0, sizeof(obtained));
+    isaac_buffered_init(&bctx, seed, sizeof(seed));
+    isaac_prefetch(&bctx);
+    isaac_prefetch(&bctx);  // Already ready: does nothing
+    buffered_read(&bctx, obtained, true);
+    atto_memeq(obtained, expected, sizeof(expected));
+    isaac_buffered_cleanup(&bctx);
+}
+
+static void test_buffered_helper_thread(void)
+{
+    static isaac_uint_t expected[BUFFERED_VALUES];
+    static isaac_uint_t obtained[BUFFERED_VALUES];
+    isaac_ctx_t ctx;
+    isaac_buffered_ctx_t bctx;
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, expected, BUFFERED_VALUES);
+
+    isaac_buffered_init(&bctx, NULL, 0);
+    const bool started = isaac_buffered_start(&bctx);
+    atto_eq(isaac_buffered_start(&bctx), started);  // Already running
+    buffered_read(&bctx, obtained, true);  // Prefetching does nothing
+    atto_memeq(obtained, expected, sizeof(expected));
+
+    // Stopping and restarting keeps the stream going
+    isaac_uint_t next[3 * ISAAC_ELEMENTS];
+    isaac_uint_t next_expected[3 * ISAAC_ELEMENTS];
+    isaac_stream(&ctx, next_expected, 3 * ISAAC_ELEMENTS);
+    isaac_buffered_stop(&bctx);
+    isaac_buffered_stream(&bctx, next, ISAAC_ELEMENTS);
+    isaac_buffered_start(&bctx);
+    isaac_buffered_stream(&bctx, &next[ISAAC_ELEMENTS], 2 * ISAAC_ELEMENTS);
+    atto_memeq(next, next_expected, sizeof(next));
+    isaac_buffered_cleanup(&bctx);
+    atto_eq(bctx.helper, NULL);
+}
+
+void test_isaac_buffered(void)
+{
+    test_buffered_null();
+    test_buffered_same_stream();
+    test_buffered_helper_thread();
+}
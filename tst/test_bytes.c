@@ -0,0 +1,146 @@
+/**
+ * @file
+ *
+ * Test suite of LibISAAC, testing isaac_stream_bytes().
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "test.h"
+
+#define BYTES_VALUES 700
+#define BYTES_LEN (BYTES_VALUES * sizeof(isaac_uint_t))
+
+static void test_bytes_null(void)
+{
+    isaac_ctx_t ctx;
+    uint8_t bytes[4] = {0};
+    isaac_init(&ctx, NULL, 0);
+
+    isaac_stream_bytes(NULL, bytes, sizeof(bytes), ISAAC_LITTLE_ENDIAN);
+    isaac_stream_bytes(&ctx, NULL, sizeof(bytes), ISAAC_LITTLE_ENDIAN);
+    isaac_stream_bytes(&ctx, bytes, sizeof(bytes), (isaac_byte_order_t) 42);
+
+    atto_zeros(bytes, sizeof(bytes));
+    atto_eq(ctx.stream_index, 0);
+    atto_eq(ctx.stream_byte, 0);
+}
+
+static void test_bytes_single_call(void)
+{
+    isaac_ctx_t ctx;
+    isaac_uint_t values[BYTES_VALUES];
+    static uint8_t expected[BYTES_LEN];
+    static uint8_t obtained[BYTES_LEN];
+    const uint8_t seed[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    isaac_init(&ctx, seed, sizeof(seed));
+    isaac_stream(&ctx, values, BYTES_VALUES);
+
+    isaac_init(&ctx, seed, sizeof(seed));
+    isaac_stream_bytes(&ctx, obtained, BYTES_LEN, ISAAC_LITTLE_ENDIAN);
+    isaac_to_little_endian(expected, values, BYTES_VALUES);
+    atto_memeq(obtained, expected, BYTES_LEN);
+    atto_eq(ctx.stream_byte, 0);
+
+    isaac_init(&ctx, seed, sizeof(seed));
+    isaac_stream_bytes(&ctx, obtained, BYTES_LEN, ISAAC_BIG_ENDIAN);
+    isaac_to_big_endian(expected, values, BYTES_VALUES);
+    atto_memeq(obtained, expected, BYTES_LEN);
+}
+
+static void test_bytes_multiple_calls(void)
+{
+    isaac_ctx_t ctx;
+    static uint8_t expected[BYTES_LEN];
+    static uint8_t obtained[BYTES_LEN];
+    for (int order = ISAAC_LITTLE_ENDIAN; order <= ISAAC_BIG_ENDIAN; order++)
+    {
+        isaac_init(&ctx, NULL, 0);
+        isaac_stream_bytes(&ctx, expected, BYTES_LEN,
+                           (isaac_byte_order_t) order);
+        isaac_init(&ctx, NULL, 0);
+        size_t taken = 0;
+        size_t chunk = 1;
+        while (taken < BYTES_LEN)
+        {
+            if (chunk > BYTES_LEN - taken)
+            {
+                chunk = BYTES_LEN - taken;
+            }
+            isaac_stream_bytes(&ctx, &obtained[taken], chunk,
+                               (isaac_byte_order_t) order);
+            taken += chunk;
+            chunk = (chunk * 7 + 3) % 1000;  // Mostly not multiples of words
+        }
+        atto_memeq(obtained, expected, BYTES_LEN);
+    }
+}
+
+static void test_bytes_partial_value_not_repeated(void)
+{
+    isaac_ctx_t ctx;
+    isaac_uint_t values[4];
+    uint8_t bytes[sizeof(isaac_uint_t)];
+    isaac_uint_t value;
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, values, 4);
+    isaac_init(&ctx, NULL, 0);
+
+    // Word-based functions skip the rest of a partially output value
+    isaac_stream_bytes(&ctx, bytes, 1, ISAAC_LITTLE_ENDIAN);
+    atto_eq(bytes[0], (uint8_t) values[0]);
+    atto_eq(ctx.stream_byte, 1);
+    isaac_stream(&ctx, &value, 1);
+    atto_eq(value, values[1]);
+    atto_eq(ctx.stream_byte, 0);
+
+    // Changing byte order skips the rest of a partially output value
+    isaac_stream_bytes(&ctx, bytes, 2, ISAAC_LITTLE_ENDIAN);
+    atto_eq(bytes[0], (uint8_t) values[2]);
+    isaac_stream_bytes(&ctx, bytes, 1, ISAAC_BIG_ENDIAN);
+    atto_eq(bytes[0], (uint8_t) (values[3] >> (8 * sizeof(isaac_uint_t) - 8)));
+}
+
+#define FUSED_VALUES (3 * ISAAC_ELEMENTS + 5)
+
+static void test_bytes_fused_many_batches(void)
+{
+    isaac_ctx_t ctx;
+    static isaac_uint_t values[FUSED_VALUES + 1];
+    static uint8_t expected[FUSED_VALUES * sizeof(isaac_uint_t)];
+    static uint8_t obtained[FUSED_VALUES * sizeof(isaac_uint_t)];
+    const size_t head = 3;  // Starts mid-value, so later batches are unaligned
+    isaac_uint_t next;
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, values, FUSED_VALUES + 1);
+
+    isaac_to_little_endian(expected, values, FUSED_VALUES);
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream_little_endian(&ctx, obtained, head);
+    isaac_stream_little_endian(&ctx, &obtained[head], sizeof(obtained) - head);
+    atto_memeq(obtained, expected, sizeof(expected));
+    isaac_stream(&ctx, &next, 1);
+    atto_eq(next, values[FUSED_VALUES]);
+
+    isaac_to_big_endian(expected, values, FUSED_VALUES);
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream_big_endian(&ctx, obtained, head);
+    isaac_stream_big_endian(&ctx, &obtained[head], sizeof(obtained) - head);
+    atto_memeq(obtained, expected, sizeof(expected));
+    isaac_stream(&ctx, &next, 1);
+    atto_eq(next, values[FUSED_VALUES]);
+
+    isaac_stream_little_endian(NULL, obtained, sizeof(obtained));
+    isaac_stream_big_endian(&ctx, NULL, sizeof(obtained));
+}
+
+void test_isaac_bytes(void)
+{
+    test_bytes_null();
+    test_bytes_single_call();
+    test_bytes_multiple_calls();
+    test_bytes_partial_value_not_repeated();
+    test_bytes_fused_many_batches();
+}
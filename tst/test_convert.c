@@ -102,8 +102,44 @@ static void test_to_big_endian(void)
 
 #endif
 
+#define CONVERT_VALUES 37  // Not a multiple of any vector width
+
+static void test_convert_long_and_in_place(void)
+{
+    isaac_uint_t values[CONVERT_VALUES];
+    isaac_uint_t in_place[CONVERT_VALUES];
+    uint8_t little[sizeof(values)];
+    uint8_t big[sizeof(values)];
+    uint8_t obtained[sizeof(values)];
+    isaac_ctx_t ctx;
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, values, CONVERT_VALUES);
+    for (size_t i = 0; i < CONVERT_VALUES; i++)
+    {
+        for (size_t b = 0; b < sizeof(isaac_uint_t); b++)
+        {
+            const uint8_t byte = (uint8_t) (values[i] >> (8U * b));
+            little[i * sizeof(isaac_uint_t) + b] = byte;
+            big[(i + 1) * sizeof(isaac_uint_t) - 1 - b] = byte;
+        }
+    }
+
+    isaac_to_little_endian(obtained, values, CONVERT_VALUES);
+    atto_memeq(obtained, little, sizeof(little));
+    isaac_to_big_endian(obtained, values, CONVERT_VALUES);
+    atto_memeq(obtained, big, sizeof(big));
+
+    memcpy(in_place, values, sizeof(values));
+    isaac_to_little_endian((uint8_t*) in_place, in_place, CONVERT_VALUES);
+    atto_memeq(in_place, little, sizeof(little));
+    memcpy(in_place, values, sizeof(values));
+    isaac_to_big_endian((uint8_t*) in_place, in_place, CONVERT_VALUES);
+    atto_memeq(in_place, big, sizeof(big));
+}
+
 void test_isaac_convert(void)
 {
     test_to_little_endian();
     test_to_big_endian();
+    test_convert_long_and_in_place();
 }
@@ -1,7 +1,7 @@
 /**
  * @file
  *
- * Test suite of LibISAAC, testing isaac_init().
+ * Test suite of LibISAAC, testing isaac_init() and isaac_init_many().
  *
  * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
  * <https://matjaz.it>. All rights reserved.
@@ -9,6 +9,7 @@
  */
 
 #include "test.h"
+#include <string.h>
 
 #if ISAAC_BITS > 32
 
@@ -857,8 +858,69 @@ static void test_init_nonzero_seed(void)
     atto_memeq(&ctx, &nonzero_initialised_ctx, sizeof(ctx));
 }
 
+#define INIT_MANY_COUNT 19U  // Two groups of lanes and a few more
+
+static void test_init_many_matches_init(void)
+{
+    static uint8_t seed_data[INIT_MANY_COUNT][ISAAC_SEED_MAX_BYTES + 10];
+    const uint8_t* seeds[INIT_MANY_COUNT];
+    uint16_t seed_bytes[INIT_MANY_COUNT];
+    static isaac_ctx_t expected[INIT_MANY_COUNT];
+    static isaac_ctx_t obtained[INIT_MANY_COUNT];
+    for (size_t i = 0; i < INIT_MANY_COUNT; i++)
+    {
+        for (size_t j = 0; j < sizeof(seed_data[i]); j++)
+        {
+            seed_data[i][j] = (uint8_t) (i * 31U + j * 7U + 1U);
+        }
+        seeds[i] = seed_data[i];
+        seed_bytes[i] = (uint16_t) ((i * 37U) % sizeof(seed_data[i]));
+    }
+    seeds[3] = NULL;
+    seed_bytes[5] = ISAAC_SEED_MAX_BYTES + 10;  // Truncated
+    for (size_t i = 0; i < INIT_MANY_COUNT; i++)
+    {
+        isaac_init(&expected[i], seeds[i], seed_bytes[i]);
+    }
+
+    for (size_t k = 0; k < TEST_KERNELS; k++)
+    {
+        if (!isaac_kernel_select(test_kernel_names[k]))
+        {
+            continue;  // Not supported by this CPU
+        }
+        memset(obtained, 0xAB, sizeof(obtained));
+        isaac_init_many(obtained, seeds, seed_bytes, INIT_MANY_COUNT);
+        atto_memeq(obtained, expected, sizeof(expected));
+    }
+    atto_eq(isaac_kernel_select(NULL), true);
+}
+
+static void test_init_many_zero_seeds(void)
+{
+    static isaac_ctx_t obtained[ISAAC_X8_LANES + 1];
+    const uint16_t seed_bytes[ISAAC_X8_LANES + 1] = {0};
+    isaac_init_many(obtained, NULL, NULL, ISAAC_X8_LANES + 1);
+    for (size_t i = 0; i < ISAAC_X8_LANES + 1; i++)
+    {
+        atto_memeq(&obtained[i], &zero_initialised_ctx, sizeof(obtained[i]));
+    }
+    memset(obtained, 0, sizeof(obtained));
+    isaac_init_many(obtained, NULL, seed_bytes, ISAAC_X8_LANES + 1);
+    atto_memeq(&obtained[ISAAC_X8_LANES - 1], &zero_initialised_ctx,
+               sizeof(obtained[0]));
+
+    // Does nothing
+    memset(obtained, 0, sizeof(obtained));
+    isaac_init_many(NULL, NULL, NULL, 3);
+    isaac_init_many(obtained, NULL, NULL, 0);
+    atto_zeros((const uint8_t*) obtained, sizeof(obtained));
+}
+
 void test_isaac_init(void)
 {
     test_init_zero_seed();
     test_init_nonzero_seed();
+    test_init_many_matches_init();
+    test_init_many_zero_seeds();
 }
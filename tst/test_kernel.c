@@ -0,0 +1,73 @@
+/**
+ * @file
+ *
+ * Test suite of LibISAAC, testing the runtime selection of the kernels.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "test.h"
+
+#define KERNEL_STREAM_LEN 300
+
+const char* const test_kernel_names[TEST_KERNELS] = {
+        "portable", "sse4", "avx2", "avx512", "neon"
+};
+
+static void test_kernel_name(void)
+{
+    atto_neq(isaac_kernel_name(), NULL);
+    atto_false(isaac_kernel_select("unknown"));
+    atto_eq(isaac_kernel_select("portable"), true);
+    atto_streq(isaac_kernel_name(), "portable", 16);
+    atto_eq(isaac_kernel_select(NULL), true);
+}
+
+static void test_kernels_same_output(void)
+{
+    static isaac_x4_ctx_t ctx4;
+    static isaac_x8_ctx_t ctx8;
+    static isaac_uint_t expected[ISAAC_X8_LANES][KERNEL_STREAM_LEN];
+    static isaac_uint_t obtained[ISAAC_X8_LANES][KERNEL_STREAM_LEN];
+    isaac_uint_t* outputs[ISAAC_X8_LANES];
+    uint8_t expected_bytes[KERNEL_STREAM_LEN * sizeof(isaac_uint_t)];
+    uint8_t obtained_bytes[KERNEL_STREAM_LEN * sizeof(isaac_uint_t)];
+    isaac_ctx_t scalar;
+
+    isaac_init(&scalar, NULL, 0);
+    for (uint8_t lane = 0; lane < ISAAC_X8_LANES; lane++)
+    {
+        isaac_stream(&scalar, expected[lane], KERNEL_STREAM_LEN);
+        outputs[lane] = obtained[lane];
+    }
+    atto_eq(isaac_kernel_select("portable"), true);
+    memset(expected_bytes, 0, sizeof(expected_bytes));
+    isaac_to_big_endian(expected_bytes, expected[0], KERNEL_STREAM_LEN - 1);
+    for (size_t k = 0; k < TEST_KERNELS; k++)
+    {
+        if (!isaac_kernel_select(test_kernel_names[k]))
+        {
+            continue;  // Not supported by this CPU
+        }
+        isaac_init(&scalar, NULL, 0);
+        isaac_x8_init(&ctx8, NULL, NULL);
+        isaac_x8_stream(&ctx8, outputs, KERNEL_STREAM_LEN);
+        atto_memeq(obtained[0], expected[0], sizeof(expected[0]));
+        isaac_x4_init(&ctx4, NULL, NULL);
+        isaac_x4_stream(&ctx4, outputs, KERNEL_STREAM_LEN);
+        atto_memeq(obtained[3], expected[0], sizeof(expected[0]));
+        memset(obtained_bytes, 0, sizeof(obtained_bytes));
+        isaac_to_big_endian(obtained_bytes, expected[0],
+                            KERNEL_STREAM_LEN - 1);
+        atto_memeq(obtained_bytes, expected_bytes, sizeof(obtained_bytes));
+    }
+    atto_eq(isaac_kernel_select(NULL), true);
+}
+
+void test_isaac_kernel(void)
+{
+    test_kernel_name();
+    test_kernels_same_output();
+}
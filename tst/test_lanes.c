@@ -0,0 +1,128 @@
+/**
+ * @file
+ *
+ * Test suite of LibISAAC, testing the multi-lane contexts.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "test.h"
+
+#define LANES_STREAM_LEN 600
+
+static void test_x4_stream_matches_scalar(void)
+{
+    static isaac_x4_ctx_t ctx;
+    isaac_ctx_t scalar;
+    uint8_t seed_values[ISAAC_X4_LANES][8];
+    const uint8_t* seeds[ISAAC_X4_LANES];
+    uint16_t seed_bytes[ISAAC_X4_LANES];
+    static isaac_uint_t lanes[ISAAC_X4_LANES][LANES_STREAM_LEN];
+    isaac_uint_t* outputs[ISAAC_X4_LANES];
+    isaac_uint_t expected[LANES_STREAM_LEN];
+    for (uint8_t lane = 0; lane < ISAAC_X4_LANES; lane++)
+    {
+        for (uint8_t i = 0; i < 8; i++)
+        {
+            seed_values[lane][i] = (uint8_t) (lane * 8U + i);
+        }
+        seeds[lane] = seed_values[lane];
+        seed_bytes[lane] = (uint16_t) (lane + 5U);
+        outputs[lane] = lanes[lane];
+    }
+    seeds[1] = NULL;  // Zero seed on one lane
+
+    isaac_x4_init(&ctx, seeds, seed_bytes);
+    isaac_x4_stream(&ctx, outputs, LANES_STREAM_LEN);
+
+    for (uint8_t lane = 0; lane < ISAAC_X4_LANES; lane++)
+    {
+        isaac_init(&scalar, seeds[lane], seed_bytes[lane]);
+        isaac_stream(&scalar, expected, LANES_STREAM_LEN);
+        atto_memeq(lanes[lane], expected, sizeof(expected));
+    }
+    atto_eq(ctx.stream_index, scalar.stream_index);
+}
+
+static void test_x8_stream_matches_scalar_multiple_calls(void)
+{
+    static isaac_x8_ctx_t ctx;
+    isaac_ctx_t scalar;
+    uint8_t seed_values[ISAAC_X8_LANES][16];
+    const uint8_t* seeds[ISAAC_X8_LANES];
+    uint16_t seed_bytes[ISAAC_X8_LANES];
+    static isaac_uint_t lanes[ISAAC_X8_LANES][LANES_STREAM_LEN];
+    isaac_uint_t* outputs[ISAAC_X8_LANES];
+    isaac_uint_t expected[LANES_STREAM_LEN];
+    for (uint8_t lane = 0; lane < ISAAC_X8_LANES; lane++)
+    {
+        for (uint8_t i = 0; i < 16; i++)
+        {
+            seed_values[lane][i] = (uint8_t) (lane ^ (i * 31U));
+        }
+        seeds[lane] = seed_values[lane];
+        seed_bytes[lane] = 16;
+    }
+
+    isaac_x8_init(&ctx, seeds, seed_bytes);
+    for (uint16_t call = 0; call < LANES_STREAM_LEN / 3; call++)
+    {
+        for (uint8_t lane = 0; lane < ISAAC_X8_LANES; lane++)
+        {
+            outputs[lane] = &lanes[lane][3 * call];
+        }
+        isaac_x8_stream(&ctx, outputs, 3);
+    }
+
+    for (uint8_t lane = 0; lane < ISAAC_X8_LANES; lane++)
+    {
+        isaac_init(&scalar, seeds[lane], seed_bytes[lane]);
+        isaac_stream(&scalar, expected, LANES_STREAM_LEN);
+        atto_memeq(lanes[lane], expected, sizeof(expected));
+    }
+}
+
+static void test_x8_stream_skips_null_lanes(void)
+{
+    static isaac_x8_ctx_t ctx;
+    isaac_ctx_t scalar;
+    isaac_uint_t lane3[LANES_STREAM_LEN];
+    isaac_uint_t expected[LANES_STREAM_LEN];
+    isaac_uint_t* outputs[ISAAC_X8_LANES] = {NULL};
+    outputs[3] = lane3;
+
+    isaac_x8_init(&ctx, NULL, NULL);
+    isaac_x8_stream(&ctx, outputs, LANES_STREAM_LEN);
+    isaac_x8_stream(&ctx, NULL, LANES_STREAM_LEN);
+    isaac_x8_stream(NULL, outputs, LANES_STREAM_LEN);
+
+    isaac_init(&scalar, NULL, 0);
+    isaac_stream(&scalar, expected, LANES_STREAM_LEN);
+    atto_memeq(lane3, expected, sizeof(expected));
+}
+
+static void test_lanes_cleanup(void)
+{
+    static isaac_x4_ctx_t ctx4;
+    static isaac_x8_ctx_t ctx8;
+    memset(&ctx4, 0xFFU, sizeof(ctx4));
+    memset(&ctx8, 0xFFU, sizeof(ctx8));
+
+    isaac_x4_cleanup(&ctx4);
+    isaac_x8_cleanup(&ctx8);
+    isaac_x4_cleanup(NULL);
+    isaac_x8_cleanup(NULL);
+
+    atto_zeros((uint8_t*) &ctx4, sizeof(ctx4));
+    atto_zeros((uint8_t*) &ctx8, sizeof(ctx8));
+}
+
+void test_isaac_lanes(void)
+{
+    test_x4_stream_matches_scalar();
+    test_x8_stream_matches_scalar_multiple_calls();
+    test_x8_stream_skips_null_lanes();
+    test_lanes_cleanup();
+}
@@ -0,0 +1,101 @@
+/**
+ * @file
+ *
+ * Test suite of LibISAAC, testing the lean context #isaac_lean_ctx_t.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "test.h"
+#include <string.h>
+
+#define LEAN_VALUES (4 * ISAAC_ELEMENTS + 77)
+
+static void test_lean_size(void)
+{
+    atto_lt(sizeof(isaac_lean_ctx_t), sizeof(isaac_ctx_t) / 2 + 64);
+}
+
+static void test_lean_null(void)
+{
+    isaac_lean_ctx_t ctx;
+    isaac_uint_t value = 42;
+    isaac_lean_init(&ctx, NULL, 0);
+
+    isaac_lean_init(NULL, NULL, 0);
+    isaac_lean_stream(NULL, &value, 1);
+    isaac_lean_stream(&ctx, NULL, 1);
+    isaac_lean_cleanup(NULL);
+    atto_eq(value, 42);
+    atto_eq(ctx.index, 0);
+}
+
+static void test_lean_matches_stream(void)
+{
+    isaac_ctx_t ctx;
+    isaac_lean_ctx_t lean;
+    static isaac_uint_t expected[LEAN_VALUES];
+    static isaac_uint_t obtained[LEAN_VALUES];
+    const uint8_t seed[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    const size_t chunks[] = {1, 3, ISAAC_ELEMENTS - 1, 2 * ISAAC_ELEMENTS + 5};
+    isaac_init(&ctx, seed, sizeof(seed));
+    isaac_stream(&ctx, expected, LEAN_VALUES);
+
+    // Whole stream at once, mostly whole batches
+    isaac_lean_init(&lean, seed, sizeof(seed));
+    isaac_lean_stream(&lean, obtained, LEAN_VALUES);
+    atto_memeq(obtained, expected, sizeof(expected));
+
+    // Chunks crossing the batches at any point
+    for (size_t i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++)
+    {
+        memset(obtained, 0, sizeof(obtained));
+        isaac_lean_init(&lean, seed, sizeof(seed));
+        size_t taken = 0;
+        while (taken < LEAN_VALUES)
+        {
+            size_t chunk = chunks[i];
+            if (chunk > LEAN_VALUES - taken)
+            {
+                chunk = LEAN_VALUES - taken;
+            }
+            isaac_lean_stream(&lean, &obtained[taken], chunk);
+            taken += chunk;
+        }
+        atto_memeq(obtained, expected, sizeof(expected));
+    }
+}
+
+static void test_lean_zero_seed(void)
+{
+    isaac_ctx_t ctx;
+    isaac_lean_ctx_t lean;
+    isaac_uint_t expected[ISAAC_ELEMENTS + 1];
+    isaac_uint_t obtained[ISAAC_ELEMENTS + 1];
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, expected, ISAAC_ELEMENTS + 1);
+    isaac_lean_init(&lean, NULL, 0);
+    isaac_lean_stream(&lean, obtained, 10);
+    isaac_lean_stream(&lean, &obtained[10], ISAAC_ELEMENTS + 1 - 10);
+    atto_memeq(obtained, expected, sizeof(expected));
+    atto_eq(lean.index, 1);
+}
+
+static void test_lean_cleanup(void)
+{
+    isaac_lean_ctx_t lean;
+    isaac_lean_init(&lean, NULL, 0);
+    isaac_lean_cleanup(&lean);
+    atto_zeros((const uint8_t*) &lean, sizeof(lean));
+}
+
+void test_isaac_lean(void)
+{
+    test_lean_size();
+    test_lean_null();
+    test_lean_matches_stream();
+    test_lean_zero_seed();
+    test_lean_cleanup();
+}
@@ -0,0 +1,95 @@
+/**
+ * @file
+ *
+ * Test suite of LibISAAC, testing the parallel generation.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "test.h"
+#include <string.h>
+
+/* Some whole chunks and a partial one. */
+#define PARALLEL_WORDS (5U * ISAAC_FILL_CHUNK_WORDS + 1234U)
+
+static void test_parallel_null(void)
+{
+    isaac_uint_t out[4] = {0};
+    isaac_fill_parallel(NULL, 0, NULL, 4, 2);
+    isaac_fill_parallel(NULL, 0, out, 0, 2);
+    atto_zeros(out, 4);
+}
+
+static void test_parallel_chunks_are_seeded_streams(void)
+{
+    static isaac_uint_t obtained[PARALLEL_WORDS];
+    static isaac_uint_t expected[ISAAC_FILL_CHUNK_WORDS];
+    uint8_t seed[ISAAC_SEED_MAX_BYTES] = {0};
+    const uint8_t master[5] = {1, 2, 3, 4, 5};
+    isaac_ctx_t ctx;
+    isaac_fill_parallel(master, sizeof(master), obtained, PARALLEL_WORDS, 3);
+
+    memcpy(seed, master, sizeof(master));
+    for (size_t chunk = 0; chunk * ISAAC_FILL_CHUNK_WORDS < PARALLEL_WORDS;
+         chunk++)
+    {
+        // Chunk index in the last 8 bytes of the seed
+        seed[ISAAC_SEED_MAX_BYTES - 8] = (uint8_t) chunk;
+        isaac_init(&ctx, seed, ISAAC_SEED_MAX_BYTES);
+        size_t amount = PARALLEL_WORDS - chunk * ISAAC_FILL_CHUNK_WORDS;
+        if (amount > ISAAC_FILL_CHUNK_WORDS)
+        {
+            amount = ISAAC_FILL_CHUNK_WORDS;
+        }
+        isaac_stream(&ctx, expected, amount);
+        atto_memeq(&obtained[chunk * ISAAC_FILL_CHUNK_WORDS], expected,
+                   amount * sizeof(isaac_uint_t));
+    }
+}
+
+static void test_parallel_independent_of_threads(void)
+{
+    static isaac_uint_t expected[PARALLEL_WORDS];
+    static isaac_uint_t obtained[PARALLEL_WORDS];
+    const uint8_t master[3] = {7, 8, 9};
+    static const size_t threads[] = {0, 2, 4, 7, 1000};
+    isaac_fill_parallel(master, sizeof(master), expected, PARALLEL_WORDS, 1);
+    for (size_t i = 0; i < sizeof(threads) / sizeof(threads[0]); i++)
+    {
+        memset(obtained, 0, sizeof(obtained));
+        isaac_fill_parallel(master, sizeof(master), obtained, PARALLEL_WORDS,
+                            threads[i]);
+        atto_memeq(obtained, expected, sizeof(expected));
+    }
+    // A shorter buffer is a prefix of a longer one
+    memset(obtained, 0, sizeof(obtained));
+    isaac_fill_parallel(master, sizeof(master), obtained, 100000, 3);
+    atto_memeq(obtained, expected, 100000 * sizeof(isaac_uint_t));
+    atto_zeros(&obtained[100000], 100);
+}
+
+static void test_parallel_long_seed_truncated(void)
+{
+    isaac_uint_t expected[100];
+    isaac_uint_t obtained[100];
+    uint8_t master[ISAAC_SEED_MAX_BYTES];
+    for (size_t i = 0; i < sizeof(master); i++)
+    {
+        master[i] = (uint8_t) (i + 1);
+    }
+    isaac_fill_parallel(master, ISAAC_SEED_MAX_BYTES - 8, expected, 100, 1);
+    isaac_fill_parallel(master, ISAAC_SEED_MAX_BYTES, obtained, 100, 1);
+    atto_memeq(obtained, expected, sizeof(expected));
+    isaac_fill_parallel(master, ISAAC_SEED_MAX_BYTES - 9, obtained, 100, 1);
+    atto_neq(obtained[0], expected[0]);
+}
+
+void test_isaac_parallel(void)
+{
+    test_parallel_null();
+    test_parallel_chunks_are_seeded_streams();
+    test_parallel_independent_of_threads();
+    test_parallel_long_seed_truncated();
+}
@@ -0,0 +1,236 @@
+/**
+ * @file
+ *
+ * Test suite of LibISAAC, testing the shuffles and permutations.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "test.h"
+#include <string.h>
+
+/* Large enough to take the prefetching path. */
+#define PERMUTE_LARGE (1200U * 1000U)
+#define PERMUTE_SMALL 1000U
+/* Enough stream for the positions of the large permutation. */
+#define PERMUTE_WORDS (PERMUTE_LARGE + 1000U)
+#define PERMUTE_TRIALS 60000U
+
+/**
+ * Reads the 32 bit values of the stream in order, as the library draws them.
+ */
+static uint32_t reference_next_u32(const isaac_uint_t* const words,
+                                   size_t* const next)
+{
+#if ISAAC_BITS > 32
+    const uint32_t value =
+            (uint32_t) (words[*next / 2] >> (32U * (*next % 2)));
+#else
+    const uint32_t value = words[*next];
+#endif
+    (*next)++;
+    return value;
+}
+
+/** Lemire's method written plainly. */
+static uint32_t reference_bounded(const isaac_uint_t* const words,
+                                  size_t* const next,
+                                  const uint32_t bound)
+{
+    uint64_t m;
+    do
+    {
+        m = (uint64_t) reference_next_u32(words, next) * bound;
+    }
+    while ((uint32_t) m < (uint32_t) (-bound % bound));
+    return (uint32_t) (m >> 32U);
+}
+
+static bool is_permutation(const uint32_t* const values, const uint32_t n)
+{
+    static bool seen[PERMUTE_LARGE];
+    memset(seen, 0, n * sizeof(bool));
+    for (uint32_t i = 0; i < n; i++)
+    {
+        if (values[i] >= n || seen[values[i]])
+        {
+            return false;
+        }
+        seen[values[i]] = true;
+    }
+    return true;
+}
+
+static void test_permute_null(void)
+{
+    isaac_ctx_t ctx;
+    uint32_t values[4] = {0};
+    isaac_init(&ctx, NULL, 0);
+
+    isaac_shuffle_array(NULL, values, 4, sizeof(uint32_t));
+    isaac_shuffle_array(&ctx, NULL, 4, sizeof(uint32_t));
+    isaac_shuffle_array(&ctx, values, 1, sizeof(uint32_t));
+    isaac_shuffle_array(&ctx, values, 4, 0);
+    isaac_permutation_u32(NULL, values, 4);
+    isaac_permutation_u32(&ctx, NULL, 4);
+    isaac_permutation_u32(&ctx, values, 0);
+
+    atto_zeros(values, 4);
+    atto_eq(ctx.stream_index, 0);
+}
+
+static void test_permute_shuffle_matches_reference(void)
+{
+    static const uint32_t counts[] = {2, PERMUTE_SMALL, PERMUTE_LARGE};
+    static isaac_uint_t words[PERMUTE_WORDS];
+    static uint32_t expected[PERMUTE_LARGE];
+    static uint32_t obtained[PERMUTE_LARGE];
+    isaac_ctx_t ctx;
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++)
+    {
+        const uint32_t count = counts[c];
+        isaac_init(&ctx, NULL, 0);
+        isaac_stream(&ctx, words, PERMUTE_WORDS);
+        size_t next = 0;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            expected[i] = i;
+            obtained[i] = i;
+        }
+        for (uint32_t i = count - 1; i > 0; i--)
+        {
+            const uint32_t j = reference_bounded(words, &next, i + 1);
+            const uint32_t tmp = expected[i];
+            expected[i] = expected[j];
+            expected[j] = tmp;
+        }
+
+        isaac_init(&ctx, NULL, 0);
+        isaac_shuffle_array(&ctx, obtained, count, sizeof(uint32_t));
+        atto_memeq(obtained, expected, count * sizeof(uint32_t));
+        atto_assert(is_permutation(obtained, count));
+        // The next draw starts from the next unused integer of the stream
+        isaac_uint_t after;
+        isaac_stream(&ctx, &after, 1);
+#if ISAAC_BITS > 32
+        atto_eq(after, words[(next + 1) / 2]);
+#else
+        atto_eq(after, words[next]);
+#endif
+    }
+}
+
+static void test_permute_shuffle_any_size(void)
+{
+    // Same positions drawn whatever the size of the elements
+    static uint32_t expected[PERMUTE_SMALL];
+    static uint8_t obtained[PERMUTE_SMALL][100];
+    static const size_t sizes[] = {1, 3, 8, 100};
+    isaac_ctx_t ctx;
+    for (uint32_t i = 0; i < PERMUTE_SMALL; i++)
+    {
+        expected[i] = i;
+    }
+    isaac_init(&ctx, NULL, 0);
+    isaac_shuffle_array(&ctx, expected, PERMUTE_SMALL, sizeof(uint32_t));
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        const size_t size = sizes[s];
+        uint8_t* const bytes = &obtained[0][0];
+        for (uint32_t i = 0; i < PERMUTE_SMALL; i++)
+        {
+            memset(&bytes[i * size], (uint8_t) (i + 1), size);
+            memcpy(&bytes[i * size], &i, size < 2 ? size : 2);
+        }
+        isaac_init(&ctx, NULL, 0);
+        isaac_shuffle_array(&ctx, bytes, PERMUTE_SMALL, size);
+        for (uint32_t i = 0; i < PERMUTE_SMALL; i++)
+        {
+            uint8_t element[100];
+            const uint32_t origin = expected[i];
+            memset(element, (uint8_t) (origin + 1), size);
+            memcpy(element, &origin, size < 2 ? size : 2);
+            atto_memeq(&bytes[i * size], element, size);
+        }
+    }
+}
+
+static void test_permute_permutation_matches_reference(void)
+{
+    static const uint32_t counts[] = {1, 2, PERMUTE_SMALL, PERMUTE_LARGE};
+    static isaac_uint_t words[PERMUTE_WORDS];
+    static uint32_t expected[PERMUTE_LARGE];
+    static uint32_t obtained[PERMUTE_LARGE];
+    isaac_ctx_t ctx;
+    for (size_t c = 0; c < sizeof(counts) / sizeof(counts[0]); c++)
+    {
+        const uint32_t n = counts[c];
+        isaac_init(&ctx, NULL, 0);
+        isaac_stream(&ctx, words, PERMUTE_WORDS);
+        size_t next = 0;
+        expected[0] = 0;
+        for (uint32_t i = 1; i < n; i++)
+        {
+            const uint32_t j = reference_bounded(words, &next, i + 1);
+            expected[i] = expected[j];
+            expected[j] = i;
+        }
+
+        isaac_init(&ctx, NULL, 0);
+        isaac_permutation_u32(&ctx, obtained, n);
+        atto_memeq(obtained, expected, n * sizeof(uint32_t));
+        atto_assert(is_permutation(obtained, n));
+    }
+}
+
+static void test_permute_uniform(void)
+{
+    // Each of the 6 orders of 3 elements is equally likely
+    uint32_t frequencies[3][3][3] = {{{0}}};
+    uint32_t frequencies_perm[3][3][3] = {{{0}}};
+    isaac_ctx_t ctx;
+    isaac_init(&ctx, NULL, 0);
+    for (uint32_t t = 0; t < PERMUTE_TRIALS; t++)
+    {
+        uint8_t values[3] = {0, 1, 2};
+        uint32_t perm[3];
+        isaac_shuffle_array(&ctx, values, 3, 1);
+        frequencies[values[0]][values[1]][values[2]]++;
+        isaac_permutation_u32(&ctx, perm, 3);
+        frequencies_perm[perm[0]][perm[1]][perm[2]]++;
+    }
+    const uint32_t expected = PERMUTE_TRIALS / 6;
+    for (uint8_t a = 0; a < 3; a++)
+    {
+        for (uint8_t b = 0; b < 3; b++)
+        {
+            for (uint8_t c = 0; c < 3; c++)
+            {
+                if (a == b || b == c || a == c)
+                {
+                    atto_eq(frequencies[a][b][c], 0);
+                    atto_eq(frequencies_perm[a][b][c], 0);
+                }
+                else
+                {
+                    // About 5 standard deviations
+                    atto_gt(frequencies[a][b][c], expected - 460);
+                    atto_lt(frequencies[a][b][c], expected + 460);
+                    atto_gt(frequencies_perm[a][b][c], expected - 460);
+                    atto_lt(frequencies_perm[a][b][c], expected + 460);
+                }
+            }
+        }
+    }
+}
+
+void test_isaac_permute(void)
+{
+    test_permute_null();
+    test_permute_shuffle_matches_reference();
+    test_permute_shuffle_any_size();
+    test_permute_permutation_matches_reference();
+    test_permute_uniform();
+}
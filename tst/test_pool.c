@@ -0,0 +1,121 @@
+/**
+ * @file
+ *
+ * Test suite of LibISAAC, testing the pool of contexts #isaac_pool_t.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "test.h"
+
+#define POOL_VALUES 600
+/* More than fit into a slab, for both variants. */
+#define POOL_CONTEXTS 1500
+
+static void test_pool_null(void)
+{
+    isaac_ctx_t ctx;
+    isaac_init(&ctx, NULL, 0);
+    isaac_pool_t* const pool = isaac_pool_new(ISAAC_POOL_DEFAULT);
+    atto_neq(pool, NULL);
+
+    atto_eq(isaac_pool_acquire(NULL, NULL, 0), NULL);
+    isaac_pool_release(NULL, &ctx);
+    isaac_pool_release(pool, NULL);
+    atto_eq(isaac_pool_in_use(NULL), 0);
+    atto_eq(isaac_pool_in_use(pool), 0);
+    isaac_pool_reset(NULL);
+    isaac_pool_free(NULL);
+    atto_neq(ctx.a, 0);
+    isaac_pool_free(pool);
+}
+
+static void test_pool_matches_init(void)
+{
+    isaac_ctx_t expected;
+    isaac_uint_t expected_values[POOL_VALUES];
+    isaac_uint_t obtained_values[POOL_VALUES];
+    const uint8_t seed[5] = {1, 2, 3, 4, 5};
+    isaac_init(&expected, seed, sizeof(seed));
+    isaac_stream(&expected, expected_values, POOL_VALUES);
+    isaac_pool_t* const pool = isaac_pool_new(ISAAC_POOL_DEFAULT);
+
+    isaac_ctx_t* const ctx = isaac_pool_acquire(pool, seed, sizeof(seed));
+    atto_neq(ctx, NULL);
+    atto_eq((uintptr_t) ctx % ISAAC_CACHE_LINE, 0);
+    atto_eq(isaac_pool_in_use(pool), 1);
+    isaac_stream(ctx, obtained_values, POOL_VALUES);
+    atto_memeq(obtained_values, expected_values, sizeof(expected_values));
+    isaac_pool_release(pool, ctx);
+    atto_eq(isaac_pool_in_use(pool), 0);
+    isaac_pool_free(pool);
+}
+
+static void test_pool_many_slabs(void)
+{
+    static isaac_ctx_t* ctxs[POOL_CONTEXTS];
+    isaac_uint_t value;
+    isaac_pool_t* const pool = isaac_pool_new(ISAAC_POOL_DEFAULT);
+    for (size_t i = 0; i < POOL_CONTEXTS; i++)
+    {
+        ctxs[i] = isaac_pool_acquire(pool, (const uint8_t*) &i, sizeof(i));
+        atto_neq(ctxs[i], NULL);
+        atto_eq((uintptr_t) ctxs[i] % ISAAC_CACHE_LINE, 0);
+    }
+    atto_eq(isaac_pool_in_use(pool), POOL_CONTEXTS);
+    // No two contexts overlap: each keeps its own state
+    for (size_t i = 0; i < POOL_CONTEXTS; i++)
+    {
+        isaac_stream(ctxs[i], &value, 1);
+    }
+    for (size_t i = 0; i < POOL_CONTEXTS; i++)
+    {
+        isaac_ctx_t expected;
+        isaac_uint_t expected_value;
+        isaac_init(&expected, (const uint8_t*) &i, sizeof(i));
+        isaac_stream(&expected, &expected_value, 1);
+        isaac_stream(&expected, &expected_value, 1);
+        isaac_stream(ctxs[i], &value, 1);
+        atto_eq(value, expected_value);
+    }
+
+    // The most recently released context is reused first
+    isaac_pool_release(pool, ctxs[7]);
+    isaac_pool_release(pool, ctxs[1234]);
+    atto_eq(isaac_pool_in_use(pool), POOL_CONTEXTS - 2);
+    atto_eq(isaac_pool_acquire(pool, NULL, 0), ctxs[1234]);
+    atto_eq(isaac_pool_acquire(pool, NULL, 0), ctxs[7]);
+
+    // Reset erases all contexts and carves them again in the same order
+    isaac_pool_reset(pool);
+    atto_eq(isaac_pool_in_use(pool), 0);
+    atto_zeros((const uint8_t*) ctxs[0], sizeof(isaac_ctx_t));
+    atto_zeros((const uint8_t*) ctxs[POOL_CONTEXTS - 1], sizeof(isaac_ctx_t));
+    atto_eq(isaac_pool_acquire(pool, NULL, 0), ctxs[0]);
+    atto_eq(isaac_pool_acquire(pool, NULL, 0), ctxs[1]);
+    isaac_pool_free(pool);
+}
+
+static void test_pool_protected(void)
+{
+    isaac_pool_t* const pool = isaac_pool_new(ISAAC_POOL_NO_DUMP
+                                              | ISAAC_POOL_LOCKED);
+    // Refused without support or with too low a limit of locked memory
+    if (pool != NULL)
+    {
+        isaac_ctx_t* const ctx = isaac_pool_acquire(pool, NULL, 0);
+        atto_neq(ctx, NULL);
+        isaac_pool_release(pool, ctx);
+        isaac_pool_free(pool);
+    }
+}
+
+void test_isaac_pool(void)
+{
+    test_pool_null();
+    test_pool_matches_init();
+    test_pool_many_slabs();
+    test_pool_protected();
+}
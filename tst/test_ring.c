@@ -0,0 +1,255 @@
+/**
+ * @file
+ *
+ * Test suite of LibISAAC, testing the ring buffer.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "test.h"
+
+#if ISAAC_THREADS
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#endif
+
+#define RING_BATCHES 4U
+#define RING_VALUES (RING_BATCHES * ISAAC_ELEMENTS)
+/* Many times the capacity, so the producer sleeps and wakes often. */
+#define RING_LONG_VALUES (50U * RING_VALUES)
+
+static void test_ring_null(void)
+{
+    isaac_uint_t values[4] = {0};
+    uint8_t bytes[4] = {0};
+    atto_eq(isaac_ring_new(0, NULL, 0), NULL);
+    isaac_ring_free(NULL);
+    isaac_ring_watermarks(NULL, 1, 2);
+    atto_eq(isaac_ring_available(NULL), 0);
+    atto_eq(isaac_ring_fill(NULL), 0);
+    isaac_ring_wait(NULL);
+    atto_false(isaac_ring_start(NULL));
+    atto_eq(isaac_ring_read(NULL, values, 4), 0);
+    atto_eq(isaac_ring_read_bytes(NULL, bytes, 4), 0);
+
+    isaac_ring_t* const ring = isaac_ring_new(1, NULL, 0);
+    atto_neq(ring, NULL);
+    isaac_ring_fill(ring);
+    atto_eq(isaac_ring_read(ring, NULL, 4), 0);
+    atto_eq(isaac_ring_read_bytes(ring, NULL, 4), 0);
+    atto_eq(isaac_ring_available(ring), ISAAC_ELEMENTS);
+    atto_zeros(values, 4);
+    atto_zeros(bytes, 4);
+    isaac_ring_free(ring);
+}
+
+static void test_ring_same_stream(void)
+{
+    static isaac_uint_t expected[3 * RING_VALUES];
+    static isaac_uint_t obtained[3 * RING_VALUES];
+    isaac_ctx_t ctx;
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, expected, 3 * RING_VALUES);
+    isaac_ring_t* const ring = isaac_ring_new(3, NULL, 0);  // Rounded to 4
+
+    atto_eq(isaac_ring_read(ring, obtained, 10), 0);  // Empty
+    atto_eq(isaac_ring_fill(ring), RING_BATCHES);
+    atto_eq(isaac_ring_fill(ring), 0);  // Full
+    atto_eq(isaac_ring_available(ring), RING_VALUES);
+    atto_eq(isaac_ring_read(ring, obtained, 10), 10);
+    atto_eq(isaac_ring_read(ring, &obtained[10], RING_VALUES), RING_VALUES - 10);
+    atto_eq(isaac_ring_available(ring), 0);
+
+    // Wrapping around
+    size_t taken = RING_VALUES;
+    while (taken < 3 * RING_VALUES)
+    {
+        isaac_ring_fill(ring);
+        const size_t chunk = 3 * RING_VALUES - taken;
+        taken += isaac_ring_read(ring, &obtained[taken],
+                                 chunk < 300 ? chunk : 300);
+    }
+    atto_memeq(obtained, expected, sizeof(expected));
+    isaac_ring_free(ring);
+}
+
+static void test_ring_watermarks(void)
+{
+    isaac_uint_t values[ISAAC_ELEMENTS];
+    isaac_ring_t* const ring = isaac_ring_new(RING_BATCHES, NULL, 0);
+    isaac_ring_watermarks(ring, 10, 2 * ISAAC_ELEMENTS + 1);
+    atto_eq(isaac_ring_fill(ring), 2);
+    atto_eq(isaac_ring_read(ring, values, 1), 1);
+    atto_eq(isaac_ring_fill(ring), 0);  // Not a whole batch under the mark
+    atto_eq(isaac_ring_read(ring, values, ISAAC_ELEMENTS), ISAAC_ELEMENTS);
+    atto_eq(isaac_ring_fill(ring), 1);
+
+    // Clamped to the capacity
+    isaac_ring_watermarks(ring, SIZE_MAX, SIZE_MAX);
+    atto_eq(isaac_ring_fill(ring), 2);
+    atto_eq(isaac_ring_available(ring), RING_VALUES - 1);
+    isaac_ring_free(ring);
+}
+
+static void test_ring_bytes(void)
+{
+    isaac_uint_t values[3];
+    uint8_t expected[3 * sizeof(isaac_uint_t)];
+    uint8_t obtained[sizeof(expected)];
+    isaac_ctx_t ctx;
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, values, 3);
+    isaac_to_little_endian(expected, values, 3);
+    isaac_ring_t* const ring = isaac_ring_new(1, NULL, 0);
+    isaac_ring_fill(ring);
+
+    // The rest of a partially used integer is discarded
+    atto_eq(isaac_ring_read_bytes(ring, obtained, 3), 3);
+    atto_eq(isaac_ring_read_bytes(ring, &obtained[sizeof(isaac_uint_t)],
+                                  2 * sizeof(isaac_uint_t)),
+            2 * sizeof(isaac_uint_t));
+    atto_memeq(obtained, expected, 3);
+    atto_memeq(&obtained[sizeof(isaac_uint_t)], &expected[sizeof(isaac_uint_t)],
+               2 * sizeof(isaac_uint_t));
+    atto_eq(isaac_ring_available(ring), ISAAC_ELEMENTS - 3);
+
+    // Stops at the empty ring
+    static uint8_t all[ISAAC_ELEMENTS * sizeof(isaac_uint_t)];
+    atto_eq(isaac_ring_read_bytes(ring, all, sizeof(all)),
+            (ISAAC_ELEMENTS - 3) * sizeof(isaac_uint_t));
+    isaac_ring_free(ring);
+}
+
+static void test_ring_producer_thread(void)
+{
+    static isaac_uint_t expected[RING_LONG_VALUES];
+    static isaac_uint_t obtained[RING_LONG_VALUES];
+    isaac_ctx_t ctx;
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, expected, RING_LONG_VALUES);
+    isaac_ring_t* const ring = isaac_ring_new(RING_BATCHES, NULL, 0);
+    if (!isaac_ring_start(ring))
+    {
+        isaac_ring_free(ring);
+        return;  // Built without threads support
+    }
+    atto_assert(isaac_ring_start(ring));  // Already running
+    size_t taken = 0;
+    size_t chunk = 1;
+    while (taken < RING_LONG_VALUES)
+    {
+        if (chunk > RING_LONG_VALUES - taken)
+        {
+            chunk = RING_LONG_VALUES - taken;
+        }
+        taken += isaac_ring_read(ring, &obtained[taken], chunk);
+        chunk = (chunk * 7 + 3) % 700;
+    }
+    atto_memeq(obtained, expected, sizeof(expected));
+    isaac_ring_free(ring);
+}
+
+#if ISAAC_THREADS
+#define RING_CONSUMERS 4U
+#define RING_MAX_CHUNK 700U
+/* A consumer can overshoot the total by one read. */
+#define RING_MAX_TAKEN (RING_LONG_VALUES + RING_CONSUMERS * RING_MAX_CHUNK)
+
+/** Integers read by a consumer thread from the shared ring. */
+typedef struct
+{
+    isaac_ring_t* ring;
+    atomic_size_t* total;
+    isaac_uint_t values[RING_MAX_TAKEN];
+    size_t taken;
+    size_t first_chunk;
+} ring_consumer_t;
+
+/**
+ * Consumer thread: reads chunks of varying size from the shared ring until
+ * all consumers together took at least #RING_LONG_VALUES integers.
+ */
+static void* ring_consume(void* const arg)
+{
+    ring_consumer_t* const consumer = arg;
+    size_t chunk = consumer->first_chunk;
+    while (atomic_load(consumer->total) < RING_LONG_VALUES)
+    {
+        const size_t read = isaac_ring_read(
+                consumer->ring, &consumer->values[consumer->taken], chunk);
+        consumer->taken += read;
+        atomic_fetch_add(consumer->total, read);
+        if (read == 0)
+        {
+            sched_yield();  // Let the producer fill the ring
+        }
+        chunk = (chunk * 7 + 3) % RING_MAX_CHUNK + 1;
+    }
+    return NULL;
+}
+
+static int ring_compare(const void* const a, const void* const b)
+{
+    const isaac_uint_t x = *(const isaac_uint_t*) a;
+    const isaac_uint_t y = *(const isaac_uint_t*) b;
+    return (x > y) - (x < y);
+}
+
+static void test_ring_concurrent_consumers(void)
+{
+    static isaac_uint_t expected[RING_MAX_TAKEN];
+    static isaac_uint_t obtained[RING_MAX_TAKEN];
+    static ring_consumer_t consumers[RING_CONSUMERS];
+    pthread_t threads[RING_CONSUMERS];
+    atomic_size_t total;
+    isaac_ctx_t ctx;
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, expected, RING_MAX_TAKEN);
+    isaac_ring_t* const ring = isaac_ring_new(RING_BATCHES, NULL, 0);
+    atomic_init(&total, 0);
+    atto_assert(isaac_ring_start(ring));
+    for (size_t i = 0; i < RING_CONSUMERS; i++)
+    {
+        consumers[i].ring = ring;
+        consumers[i].total = &total;
+        consumers[i].taken = 0;
+        consumers[i].first_chunk = 1 + 97 * i;
+        atto_eq(pthread_create(&threads[i], NULL, ring_consume,
+                               &consumers[i]), 0);
+    }
+    size_t taken = 0;
+    for (size_t i = 0; i < RING_CONSUMERS; i++)
+    {
+        pthread_join(threads[i], NULL);
+        memcpy(&obtained[taken], consumers[i].values,
+               consumers[i].taken * sizeof(isaac_uint_t));
+        taken += consumers[i].taken;
+    }
+    isaac_ring_free(ring);
+
+    // Together, exactly the start of the stream: nothing lost or duplicated
+    atto_eq(taken, atomic_load(&total));
+    atto_assert(taken >= RING_LONG_VALUES);
+    atto_assert(taken <= RING_MAX_TAKEN);
+    qsort(expected, taken, sizeof(isaac_uint_t), ring_compare);
+    qsort(obtained, taken, sizeof(isaac_uint_t), ring_compare);
+    atto_memeq(obtained, expected, taken * sizeof(isaac_uint_t));
+}
+#endif
+
+void test_isaac_ring(void)
+{
+    test_ring_null();
+    test_ring_same_stream();
+    test_ring_watermarks();
+    test_ring_bytes();
+    test_ring_producer_thread();
+#if ISAAC_THREADS
+    test_ring_concurrent_consumers();
+#endif
+}
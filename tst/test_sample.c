@@ -0,0 +1,234 @@
+/**
+ * @file
+ *
+ * Test suite of LibISAAC, testing the reservoir sampler and the sampling of
+ * indices.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "test.h"
+#include <math.h>
+#include <string.h>
+
+#define SAMPLE_TRIALS 100000U
+#define SAMPLE_ITEMS 20U
+#define SAMPLE_K 5U
+#define SAMPLE_MAX_K 1000U
+
+static void test_sample_null(void)
+{
+    isaac_ctx_t ctx;
+    isaac_reservoir_t res;
+    uint64_t out[4] = {0};
+    isaac_init(&ctx, NULL, 0);
+
+    isaac_reservoir_init(NULL, &ctx, 4);
+    atto_eq(isaac_reservoir_offer(NULL), ISAAC_RESERVOIR_SKIP);
+    atto_eq(isaac_reservoir_skip(NULL, 10), 0);
+    isaac_reservoir_init(&res, &ctx, 0);
+    atto_eq(isaac_reservoir_offer(&res), ISAAC_RESERVOIR_SKIP);
+    atto_eq(isaac_reservoir_skip(&res, 10), 0);
+
+    isaac_sample_indices(NULL, 10, 4, out);
+    isaac_sample_indices(&ctx, 10, 4, NULL);
+    isaac_sample_indices(&ctx, 10, 0, out);
+    isaac_sample_indices(&ctx, 3, 4, out);
+    atto_zeros(out, 4);
+    atto_eq(ctx.stream_index, 0);
+}
+
+static void test_sample_reservoir_fills_in_order(void)
+{
+    isaac_ctx_t ctx;
+    isaac_reservoir_t res;
+    isaac_init(&ctx, NULL, 0);
+    isaac_reservoir_init(&res, &ctx, SAMPLE_K);
+    for (size_t i = 0; i < SAMPLE_K; i++)
+    {
+        atto_eq(isaac_reservoir_skip(&res, 10), 0);
+        atto_eq(isaac_reservoir_offer(&res), i);
+    }
+    for (size_t i = 0; i < 1000; i++)
+    {
+        const size_t slot = isaac_reservoir_offer(&res);
+        atto_assert(slot < SAMPLE_K || slot == ISAAC_RESERVOIR_SKIP);
+    }
+}
+
+/**
+ * Runs a reservoir over a stream of items, skipping the items in batches
+ * when asked to.
+ */
+static void reservoir_run(isaac_reservoir_t* const res,
+                          uint32_t* const reservoir,
+                          const uint32_t items,
+                          const bool skipping)
+{
+    uint32_t i = 0;
+    while (i < items)
+    {
+        if (skipping)
+        {
+            i += (uint32_t) isaac_reservoir_skip(res, items - i);
+            if (i >= items)
+            {
+                break;
+            }
+        }
+        const size_t slot = isaac_reservoir_offer(res);
+        if (slot != ISAAC_RESERVOIR_SKIP)
+        {
+            reservoir[slot] = i;
+        }
+        i++;
+    }
+}
+
+static void test_sample_reservoir_skip_same_result(void)
+{
+    isaac_ctx_t ctx;
+    isaac_reservoir_t res;
+    uint32_t expected[SAMPLE_K];
+    uint32_t obtained[SAMPLE_K];
+    isaac_init(&ctx, NULL, 0);
+    isaac_reservoir_init(&res, &ctx, SAMPLE_K);
+    reservoir_run(&res, expected, 100000, false);
+    atto_eq(res.seen, 100000);
+
+    isaac_init(&ctx, NULL, 0);
+    isaac_reservoir_init(&res, &ctx, SAMPLE_K);
+    reservoir_run(&res, obtained, 100000, true);
+    atto_memeq(obtained, expected, sizeof(expected));
+    atto_eq(res.seen, 100000);
+}
+
+static void test_sample_reservoir_uniform(void)
+{
+    // Each item ends in the reservoir with probability k / n
+    uint32_t frequencies[SAMPLE_ITEMS] = {0};
+    uint32_t reservoir[SAMPLE_K];
+    isaac_ctx_t ctx;
+    isaac_reservoir_t res;
+    isaac_init(&ctx, NULL, 0);
+    for (uint32_t t = 0; t < SAMPLE_TRIALS; t++)
+    {
+        isaac_reservoir_init(&res, &ctx, SAMPLE_K);
+        reservoir_run(&res, reservoir, SAMPLE_ITEMS, (t % 2) == 0);
+        for (size_t i = 0; i < SAMPLE_K; i++)
+        {
+            frequencies[reservoir[i]]++;
+        }
+    }
+    const uint32_t expected = SAMPLE_TRIALS * SAMPLE_K / SAMPLE_ITEMS;
+    for (size_t i = 0; i < SAMPLE_ITEMS; i++)
+    {
+        // About 5 standard deviations
+        atto_gt(frequencies[i], expected - 700);
+        atto_lt(frequencies[i], expected + 700);
+    }
+}
+
+static void test_sample_reservoir_few_draws(void)
+{
+    // Items entering the reservoir grow with k * log(n / k)
+    isaac_ctx_t ctx;
+    isaac_reservoir_t res;
+    isaac_init(&ctx, NULL, 0);
+    isaac_reservoir_init(&res, &ctx, SAMPLE_K);
+    uint64_t i = 0;
+    uint32_t entered = 0;
+    const uint64_t items = 10000000;
+    while (i < items)
+    {
+        i += isaac_reservoir_skip(&res, items - i);
+        if (i < items)
+        {
+            entered += isaac_reservoir_offer(&res) != ISAAC_RESERVOIR_SKIP;
+            i++;
+        }
+    }
+    const double expected = SAMPLE_K * (1.0 + log((double) items / SAMPLE_K));
+    atto_gt(entered, expected / 2);
+    atto_lt(entered, expected * 2);
+}
+
+static void test_sample_indices_sorted_distinct(void)
+{
+    static const uint64_t ns[] = {
+            1, 2, 7, 1000, 13000, 1000000, 0xFFFFFFFFFFFFULL, UINT64_MAX
+    };
+    static const size_t ks[] = {1, 2, 7, 100, SAMPLE_MAX_K};
+    static uint64_t out[SAMPLE_MAX_K];
+    isaac_ctx_t ctx;
+    isaac_init(&ctx, NULL, 0);
+    for (size_t a = 0; a < sizeof(ns) / sizeof(ns[0]); a++)
+    {
+        for (size_t b = 0; b < sizeof(ks) / sizeof(ks[0]); b++)
+        {
+            if (ks[b] > ns[a])
+            {
+                continue;
+            }
+            isaac_sample_indices(&ctx, ns[a], ks[b], out);
+            for (size_t i = 0; i < ks[b]; i++)
+            {
+                atto_lt(out[i], ns[a]);
+                if (i > 0)
+                {
+                    atto_gt(out[i], out[i - 1]);
+                }
+            }
+        }
+    }
+    // All of them
+    isaac_sample_indices(&ctx, 7, 7, out);
+    for (uint64_t i = 0; i < 7; i++)
+    {
+        atto_eq(out[i], i);
+    }
+}
+
+static void test_sample_indices_uniform(void)
+{
+    // Dense samples use algorithm A, sparse ones algorithm D
+    static const uint64_t ns[] = {SAMPLE_ITEMS, 400};
+    static uint32_t frequencies[400];
+    uint64_t out[SAMPLE_K];
+    isaac_ctx_t ctx;
+    isaac_init(&ctx, NULL, 0);
+    for (size_t a = 0; a < sizeof(ns) / sizeof(ns[0]); a++)
+    {
+        const uint64_t n = ns[a];
+        const uint32_t trials = (uint32_t) (SAMPLE_TRIALS * n / SAMPLE_ITEMS);
+        memset(frequencies, 0, sizeof(frequencies));
+        for (uint32_t t = 0; t < trials; t++)
+        {
+            isaac_sample_indices(&ctx, n, SAMPLE_K, out);
+            for (size_t i = 0; i < SAMPLE_K; i++)
+            {
+                frequencies[out[i]]++;
+            }
+        }
+        const uint32_t expected = SAMPLE_TRIALS * SAMPLE_K / SAMPLE_ITEMS;
+        for (size_t i = 0; i < n; i++)
+        {
+            // About 5 standard deviations
+            atto_gt(frequencies[i], expected - 700);
+            atto_lt(frequencies[i], expected + 700);
+        }
+    }
+}
+
+void test_isaac_sample(void)
+{
+    test_sample_null();
+    test_sample_reservoir_fills_in_order();
+    test_sample_reservoir_skip_same_result();
+    test_sample_reservoir_uniform();
+    test_sample_reservoir_few_draws();
+    test_sample_indices_sorted_distinct();
+    test_sample_indices_uniform();
+}
@@ -0,0 +1,153 @@
+/**
+ * @file
+ *
+ * Test suite of LibISAAC, testing isaac_save() and isaac_load().
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "test.h"
+#include <string.h>
+
+#define SNAPSHOT_VALUES 600U
+
+static void test_snapshot_null(void)
+{
+    isaac_ctx_t ctx;
+    static uint8_t bytes[ISAAC_SNAPSHOT_MAX_BYTES];
+    isaac_init(&ctx, NULL, 0);
+    const size_t size = isaac_save(&ctx, bytes, sizeof(bytes),
+                                   ISAAC_SNAPSHOT_FULL);
+
+    atto_eq(isaac_save(NULL, bytes, sizeof(bytes), ISAAC_SNAPSHOT_FULL), 0);
+    atto_eq(isaac_save(&ctx, bytes, sizeof(bytes), (isaac_snapshot_t) 42), 0);
+    atto_eq(isaac_save(&ctx, bytes, size - 1, ISAAC_SNAPSHOT_FULL), 0);
+    atto_eq(isaac_save(&ctx, NULL, 0, ISAAC_SNAPSHOT_FULL), size);
+    atto_false(isaac_load(NULL, bytes, size));
+    atto_false(isaac_load(&ctx, NULL, size));
+    atto_false(isaac_load(&ctx, bytes, size - 1));
+    atto_false(isaac_load(&ctx, bytes, 3));
+}
+
+static void test_snapshot_format(void)
+{
+    isaac_ctx_t ctx;
+    static uint8_t bytes[ISAAC_SNAPSHOT_MAX_BYTES];
+    uint8_t expected[3 * sizeof(isaac_uint_t)];
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream_bytes(&ctx, bytes, 2 * sizeof(isaac_uint_t) + 1,
+                       ISAAC_BIG_ENDIAN);
+
+    const size_t size = isaac_save(&ctx, bytes, sizeof(bytes),
+                                   ISAAC_SNAPSHOT_FULL);
+    atto_eq(size, 16U + (3U + 2U * ISAAC_ELEMENTS) * sizeof(isaac_uint_t));
+    atto_memeq(bytes, "ISAC", 4);
+    atto_eq(bytes[4], ISAAC_SNAPSHOT_VERSION);
+    atto_eq(bytes[5], ISAAC_BITS);
+    atto_eq(bytes[6], ISAAC_SNAPSHOT_FULL);
+    atto_eq(bytes[7], 2);
+    atto_eq(bytes[8], 1);
+    atto_eq(bytes[9], ISAAC_BIG_ENDIAN);
+    atto_eq(bytes[10], 0);
+    atto_eq(bytes[11], 0);
+    const isaac_uint_t abc[3] = {ctx.a, ctx.b, ctx.c};
+    isaac_to_little_endian(expected, abc, 3);
+    atto_memeq(&bytes[12], expected, sizeof(expected));
+
+    const size_t compact = isaac_save(&ctx, bytes, sizeof(bytes),
+                                      ISAAC_SNAPSHOT_COMPACT);
+    atto_eq(compact, size - 2U * sizeof(isaac_uint_t));
+    atto_eq(bytes[6], ISAAC_SNAPSHOT_COMPACT);
+}
+
+static void test_snapshot_resumes_stream(void)
+{
+    isaac_ctx_t ctx;
+    isaac_ctx_t restored;
+    static uint8_t bytes[ISAAC_SNAPSHOT_MAX_BYTES];
+    static isaac_uint_t expected[SNAPSHOT_VALUES];
+    static isaac_uint_t obtained[SNAPSHOT_VALUES];
+    const uint8_t seed[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    uint8_t byte;
+    const size_t consumed[] = {0, 1, 100, ISAAC_ELEMENTS - 1};
+    for (int kind = ISAAC_SNAPSHOT_FULL; kind <= ISAAC_SNAPSHOT_COMPACT;
+         kind++)
+    {
+        for (size_t i = 0; i < sizeof(consumed) / sizeof(consumed[0]); i++)
+        {
+            isaac_init(&ctx, seed, sizeof(seed));
+            isaac_stream(&ctx, expected, consumed[i]);
+            isaac_stream_bytes(&ctx, &byte, 1, ISAAC_LITTLE_ENDIAN);
+            const size_t size = isaac_save(&ctx, bytes, sizeof(bytes),
+                                           (isaac_snapshot_t) kind);
+            atto_neq(size, 0);
+            memset(&restored, 0xAB, sizeof(restored));
+            atto_assert(isaac_load(&restored, bytes, size));
+            atto_eq(restored.stream_index, ctx.stream_index);
+            atto_eq(restored.stream_byte, ctx.stream_byte);
+
+            // The rest of the partial value, then the same stream
+            isaac_stream_bytes(&ctx, &byte, 1, ISAAC_LITTLE_ENDIAN);
+            isaac_stream(&ctx, expected, SNAPSHOT_VALUES);
+            uint8_t restored_byte;
+            isaac_stream_bytes(&restored, &restored_byte, 1,
+                               ISAAC_LITTLE_ENDIAN);
+            isaac_stream(&restored, obtained, SNAPSHOT_VALUES);
+            atto_eq(restored_byte, byte);
+            atto_memeq(obtained, expected, sizeof(expected));
+        }
+    }
+}
+
+static void test_snapshot_rejects_invalid(void)
+{
+    isaac_ctx_t ctx;
+    isaac_ctx_t untouched;
+    static uint8_t bytes[ISAAC_SNAPSHOT_MAX_BYTES];
+    isaac_init(&ctx, NULL, 0);
+    const size_t size = isaac_save(&ctx, bytes, sizeof(bytes),
+                                   ISAAC_SNAPSHOT_COMPACT);
+    isaac_init(&untouched, (const uint8_t*) "other", 5);
+    memcpy(&ctx, &untouched, sizeof(ctx));
+
+    // Any flipped bit is detected, by the checks or by the checksum
+    const size_t positions[] = {0, 4, 5, 6, 7, 8, 9, 10, 20, size / 2,
+                                size - 5, size - 1};
+    for (size_t i = 0; i < sizeof(positions) / sizeof(positions[0]); i++)
+    {
+        bytes[positions[i]] ^= 0x10U;
+        atto_false(isaac_load(&ctx, bytes, size));
+        bytes[positions[i]] ^= 0x10U;
+        atto_memeq(&ctx, &untouched, sizeof(ctx));
+    }
+    atto_assert(isaac_load(&ctx, bytes, sizeof(bytes)));  // Trailing bytes
+}
+
+static void test_snapshot_other_variant(void)
+{
+    isaac32_ctx_t ctx32;
+    isaac64_ctx_t ctx64;
+    static uint8_t bytes[ISAAC_SNAPSHOT_MAX_BYTES];
+    isaac32_init(&ctx32, NULL, 0);
+    isaac64_init(&ctx64, NULL, 0);
+
+    size_t size = isaac32_save(&ctx32, bytes, sizeof(bytes),
+                               ISAAC_SNAPSHOT_FULL);
+    atto_false(isaac64_load(&ctx64, bytes, sizeof(bytes)));
+    atto_assert(isaac32_load(&ctx32, bytes, size));
+    size = isaac64_save(&ctx64, bytes, sizeof(bytes), ISAAC_SNAPSHOT_FULL);
+    atto_eq(size, ISAAC_SNAPSHOT_MAX_BYTES);
+    atto_false(isaac32_load(&ctx32, bytes, sizeof(bytes)));
+    atto_assert(isaac64_load(&ctx64, bytes, size));
+}
+
+void test_isaac_snapshot(void)
+{
+    test_snapshot_null();
+    test_snapshot_format();
+    test_snapshot_resumes_stream();
+    test_snapshot_rejects_invalid();
+    test_snapshot_other_variant();
+}
@@ -0,0 +1,206 @@
+/**
+ * @file
+ *
+ * Test suite of LibISAAC, testing the splitting, cloning and reseeding of
+ * contexts.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "test.h"
+#include <string.h>
+
+#define SPLIT_VALUES 1000U
+
+/** Amount of bits differing between two streams. */
+static size_t different_bits(const isaac_uint_t* const a,
+                             const isaac_uint_t* const b)
+{
+    size_t bits = 0;
+    for (size_t i = 0; i < SPLIT_VALUES; i++)
+    {
+        isaac_uint_t diff = a[i] ^ b[i];
+        while (diff)
+        {
+            bits += diff & 1U;
+            diff >>= 1U;
+        }
+    }
+    return bits;
+}
+
+static void test_split_null(void)
+{
+    isaac_ctx_t parent;
+    isaac_ctx_t child;
+    isaac_init(&parent, NULL, 0);
+    memset(&child, 0, sizeof(child));
+
+    isaac_split(NULL, &child, 1);
+    isaac_split(&parent, NULL, 1);
+    isaac_split(&parent, &parent, 1);
+    isaac_clone(NULL, &parent);
+    isaac_clone(&child, NULL);
+    isaac_clone(&parent, &parent);
+    atto_zeros((uint8_t*) &child, sizeof(child));
+    atto_eq(parent.stream_index, 0);
+}
+
+static void test_split_reproducible(void)
+{
+    isaac_ctx_t parent;
+    isaac_ctx_t child;
+    isaac_uint_t expected[SPLIT_VALUES];
+    isaac_uint_t obtained[SPLIT_VALUES];
+    const uint8_t seed[4] = {4, 3, 2, 1};
+    isaac_init(&parent, seed, sizeof(seed));
+    isaac_split(&parent, &child, 42);
+    isaac_stream(&child, expected, SPLIT_VALUES);
+
+    isaac_init(&parent, seed, sizeof(seed));
+    isaac_split(&parent, &child, 42);
+    isaac_stream(&child, obtained, SPLIT_VALUES);
+    atto_memeq(obtained, expected, sizeof(expected));
+
+    // The parent advanced by 8 integers
+    isaac_uint_t parent_values[9];
+    isaac_init(&child, seed, sizeof(seed));
+    isaac_stream(&child, parent_values, 9);
+    isaac_stream(&parent, obtained, 1);
+    atto_eq(obtained[0], parent_values[8]);
+}
+
+static void test_split_independent(void)
+{
+    isaac_ctx_t parent;
+    isaac_ctx_t child;
+    static isaac_uint_t streams[4][SPLIT_VALUES];
+    isaac_init(&parent, NULL, 0);
+    isaac_split(&parent, &child, 1);
+    isaac_stream(&child, streams[0], SPLIT_VALUES);
+    isaac_split(&parent, &child, 2);  // Other label
+    isaac_stream(&child, streams[1], SPLIT_VALUES);
+    isaac_split(&parent, &child, 2);  // Same label, advanced parent
+    isaac_stream(&child, streams[2], SPLIT_VALUES);
+    isaac_stream(&parent, streams[3], SPLIT_VALUES);
+
+    // About half of the bits differ between any two streams
+    const size_t bits = SPLIT_VALUES * ISAAC_BITS;
+    for (size_t i = 0; i < 4; i++)
+    {
+        for (size_t j = i + 1; j < 4; j++)
+        {
+            const size_t diff = different_bits(streams[i], streams[j]);
+            atto_gt(diff, bits / 2 - bits / 50);
+            atto_lt(diff, bits / 2 + bits / 50);
+        }
+    }
+}
+
+static void test_split_clone(void)
+{
+    isaac_ctx_t ctx;
+    isaac_ctx_t copy;
+    isaac_uint_t expected[SPLIT_VALUES];
+    isaac_uint_t obtained[SPLIT_VALUES];
+    uint8_t byte;
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, expected, 300);
+    isaac_stream_bytes(&ctx, &byte, 1, ISAAC_BIG_ENDIAN);  // Partial integer
+
+    isaac_clone(&copy, &ctx);
+    isaac_stream(&ctx, expected, SPLIT_VALUES);
+    isaac_stream(&copy, obtained, SPLIT_VALUES);
+    atto_memeq(obtained, expected, sizeof(expected));
+}
+
+static void test_split_reseed_null(void)
+{
+    isaac_ctx_t ctx;
+    isaac_ctx_t expected;
+    const uint8_t entropy[4] = {1, 2, 3, 4};
+    isaac_init(&ctx, NULL, 0);
+    isaac_clone(&expected, &ctx);
+    isaac_reseed(NULL, entropy, sizeof(entropy));
+    isaac_reseed(&ctx, NULL, sizeof(entropy));
+    isaac_reseed(&ctx, entropy, 0);
+    atto_memeq(&ctx, &expected, sizeof(ctx));
+}
+
+static void test_split_reseed_keeps_batch(void)
+{
+    isaac_ctx_t ctx;
+    isaac_ctx_t reseeded;
+    const size_t kept = ISAAC_ELEMENTS - 100;
+    const size_t bits = SPLIT_VALUES * ISAAC_BITS;
+    static isaac_uint_t expected[ISAAC_ELEMENTS + SPLIT_VALUES];
+    static isaac_uint_t obtained[ISAAC_ELEMENTS + SPLIT_VALUES];
+    const uint8_t entropy[16] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, expected, 100);
+    isaac_clone(&reseeded, &ctx);
+    isaac_reseed(&reseeded, entropy, sizeof(entropy));
+
+    // The rest of the current batch is unchanged, the next ones differ
+    isaac_stream(&ctx, expected, kept + SPLIT_VALUES);
+    isaac_stream(&reseeded, obtained, kept + SPLIT_VALUES);
+    atto_memeq(obtained, expected, kept * sizeof(isaac_uint_t));
+    const size_t diff = different_bits(&obtained[kept], &expected[kept]);
+    atto_gt(diff, bits / 2 - bits / 50);
+    atto_lt(diff, bits / 2 + bits / 50);
+}
+
+static void test_split_reseed_every_byte(void)
+{
+    static uint8_t entropy[1000];
+    isaac_ctx_t base;
+    isaac_ctx_t ctx;
+    isaac_uint_t expected[ISAAC_ELEMENTS];
+    isaac_uint_t obtained[ISAAC_ELEMENTS];
+    size_t available;
+    for (size_t i = 0; i < sizeof(entropy); i++)
+    {
+        entropy[i] = (uint8_t) (i * 7 + 1);
+    }
+    isaac_init(&base, NULL, 0);
+    isaac_stream_consume(&base, ISAAC_ELEMENTS);  // Next batch: reseeded one
+    isaac_clone(&ctx, &base);
+    isaac_reseed(&ctx, entropy, sizeof(entropy));
+    isaac_stream_view(&ctx, &available);
+    isaac_stream_consume(&ctx, available);
+    isaac_stream(&ctx, expected, ISAAC_ELEMENTS);
+
+    // Same entropy, same state
+    isaac_clone(&ctx, &base);
+    isaac_reseed(&ctx, entropy, sizeof(entropy));
+    isaac_stream_consume(&ctx, ISAAC_ELEMENTS);
+    isaac_stream(&ctx, obtained, ISAAC_ELEMENTS);
+    atto_memeq(obtained, expected, sizeof(expected));
+
+    // Any byte changes the whole state, also the first and last ones
+    static const size_t positions[] = {0, 500, sizeof(entropy) - 1};
+    for (size_t p = 0; p < sizeof(positions) / sizeof(positions[0]); p++)
+    {
+        entropy[positions[p]] ^= 1U;
+        isaac_clone(&ctx, &base);
+        isaac_reseed(&ctx, entropy, sizeof(entropy));
+        isaac_stream_consume(&ctx, ISAAC_ELEMENTS);
+        isaac_stream(&ctx, obtained, ISAAC_ELEMENTS);
+        entropy[positions[p]] ^= 1U;
+        atto_neq(obtained[0], expected[0]);
+        atto_neq(obtained[ISAAC_ELEMENTS - 1], expected[ISAAC_ELEMENTS - 1]);
+    }
+}
+
+void test_isaac_split(void)
+{
+    test_split_null();
+    test_split_reproducible();
+    test_split_independent();
+    test_split_clone();
+    test_split_reseed_null();
+    test_split_reseed_keeps_batch();
+    test_split_reseed_every_byte();
+}
@@ -663,10 +663,61 @@ static void test_stream_with_nonzero_seed_multiple_calls(void)
     atto_eq(ctx.stream_index, 300 - 256);
 }
 
+#define BULK_STREAM_LEN (7 * ISAAC_ELEMENTS + 13)
+
+static void test_stream_bulk_matches_small_calls(void)
+{
+    isaac_ctx_t ctx;
+    isaac_ctx_t reference;
+    static isaac_uint_t expected[BULK_STREAM_LEN];
+    static isaac_uint_t obtained[BULK_STREAM_LEN];
+    const uint8_t seed[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    isaac_init(&ctx, seed, 8);
+    isaac_init(&reference, seed, 8);
+    for (size_t i = 0; i < BULK_STREAM_LEN; i++)
+    {
+        isaac_stream(&reference, &expected[i], 1);
+    }
+
+    // Misaligned with the batches, spanning many whole batches
+    isaac_stream(&ctx, obtained, 5);
+    isaac_stream(&ctx, &obtained[5], 4 * ISAAC_ELEMENTS + 100);
+    // Ending exactly at the end of a batch
+    isaac_stream(&ctx, &obtained[4 * ISAAC_ELEMENTS + 105],
+                 2 * ISAAC_ELEMENTS - 105);
+    isaac_stream(&ctx, &obtained[6 * ISAAC_ELEMENTS],
+                 BULK_STREAM_LEN - 6 * ISAAC_ELEMENTS);
+
+    atto_memeq(obtained, expected, sizeof(expected));
+    atto_eq(ctx.stream_index, reference.stream_index);
+    atto_memeq(&ctx, &reference, sizeof(ctx));
+}
+
+static void test_stream_nontemporal(void)
+{
+    isaac_ctx_t ctx;
+    isaac_ctx_t reference;
+    static isaac_uint_t expected[BULK_STREAM_LEN];
+    static isaac_uint_t obtained[BULK_STREAM_LEN];
+    isaac_init(&ctx, NULL, 0);
+    isaac_init(&reference, NULL, 0);
+    isaac_stream(&reference, expected, BULK_STREAM_LEN);
+
+    isaac_stream_nontemporal(NULL, obtained, BULK_STREAM_LEN);
+    isaac_stream_nontemporal(&ctx, NULL, BULK_STREAM_LEN);
+    isaac_stream_nontemporal(&ctx, obtained, 3);
+    isaac_stream_nontemporal(&ctx, &obtained[3], BULK_STREAM_LEN - 3);
+
+    atto_memeq(obtained, expected, sizeof(expected));
+    atto_memeq(&ctx, &reference, sizeof(ctx));
+}
+
 void test_isaac_next(void)
 {
     test_stream_with_zero_seed();
     test_stream_with_zero_seed_multiple_calls();
     test_stream_with_nonzero_seed();
     test_stream_with_nonzero_seed_multiple_calls();
+    test_stream_bulk_matches_small_calls();
+    test_stream_nontemporal();
 }
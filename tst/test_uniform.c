@@ -0,0 +1,219 @@
+/**
+ * @file
+ *
+ * Test suite of LibISAAC, testing the bounded integers.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "test.h"
+
+#define UNIFORM_COUNT 3000
+/* Enough stream for the rejections of the worst bound, about half. */
+#define UNIFORM_WORDS (4 * UNIFORM_COUNT + 1)
+
+/**
+ * Lemire's method written plainly, on the 32 bit values of the stream.
+ *
+ * @return amount of 32 bit values used.
+ */
+static size_t reference_u32(const isaac_uint_t* const words,
+                            uint32_t* const out,
+                            const size_t count,
+                            const uint32_t bound)
+{
+    size_t next = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        uint64_t m;
+        do
+        {
+#if ISAAC_BITS > 32
+            const uint32_t value =
+                    (uint32_t) (words[next / 2] >> (32U * (next % 2)));
+#else
+            const uint32_t value = words[next];
+#endif
+            next++;
+            m = (uint64_t) value * bound;
+        }
+        while ((uint32_t) m < (uint32_t) (-bound % bound));
+        out[i] = (uint32_t) (m >> 32U);
+    }
+    return next;
+}
+
+static void test_uniform_null(void)
+{
+    isaac_ctx_t ctx;
+    uint32_t out32[4] = {0};
+    uint64_t out64[4] = {0};
+    isaac_init(&ctx, NULL, 0);
+
+    isaac_uniform_u32(NULL, out32, 4, 10);
+    isaac_uniform_u32(&ctx, NULL, 4, 10);
+    isaac_uniform_u32(&ctx, out32, 4, 0);
+    isaac_uniform_u64(NULL, out64, 4, 10);
+    isaac_uniform_u64(&ctx, NULL, 4, 10);
+    isaac_uniform_u64(&ctx, out64, 4, 0);
+
+    atto_zeros(out32, 4);
+    atto_zeros(out64, 4);
+    atto_eq(ctx.stream_index, 0);
+}
+
+static void test_uniform_u32_matches_reference(void)
+{
+    static const uint32_t bounds[] = {
+            1, 6, 1000, 0x80000001UL, 0xFFFFFFFFUL
+    };
+    static isaac_uint_t words[UNIFORM_WORDS];
+    static uint32_t expected[UNIFORM_COUNT];
+    static uint32_t obtained[UNIFORM_COUNT];
+    isaac_ctx_t ctx;
+    isaac_uint_t next;
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, words, UNIFORM_WORDS);
+
+    for (size_t k = 0; k < TEST_KERNELS; k++)
+    {
+        if (!isaac_kernel_select(test_kernel_names[k]))
+        {
+            continue;  // Not supported by this CPU
+        }
+        for (size_t b = 0; b < sizeof(bounds) / sizeof(bounds[0]); b++)
+        {
+            size_t used = reference_u32(words, expected, UNIFORM_COUNT,
+                                        bounds[b]);
+            isaac_init(&ctx, NULL, 0);
+            isaac_uniform_u32(&ctx, obtained, UNIFORM_COUNT, bounds[b]);
+            atto_memeq(obtained, expected, sizeof(expected));
+            // The stream continues after the last integer used
+            isaac_stream(&ctx, &next, 1);
+            used = (used * sizeof(uint32_t) + sizeof(isaac_uint_t) - 1)
+                   / sizeof(isaac_uint_t);
+            atto_eq(next, words[used]);
+        }
+    }
+    atto_eq(isaac_kernel_select(NULL), true);
+}
+
+static void test_uniform_u32_unbiased(void)
+{
+    static uint32_t values[60000];
+    size_t counts[6] = {0};
+    isaac_ctx_t ctx;
+    isaac_init(&ctx, NULL, 0);
+
+    isaac_uniform_u32(&ctx, values, 60000, 6);
+    for (size_t i = 0; i < 60000; i++)
+    {
+        atto_lt(values[i], 6);
+        counts[values[i]]++;
+    }
+    for (size_t face = 0; face < 6; face++)
+    {
+        atto_gt(counts[face], 9500);
+        atto_lt(counts[face], 10500);
+    }
+}
+
+static void test_uniform_u64(void)
+{
+    static const uint64_t bounds[] = {
+            1, 6, 0x100000000ULL, 0x8000000000000001ULL, UINT64_MAX
+    };
+    uint64_t values[UNIFORM_COUNT];
+    isaac_ctx_t ctx;
+    isaac_init(&ctx, NULL, 0);
+
+    for (size_t b = 0; b < sizeof(bounds) / sizeof(bounds[0]); b++)
+    {
+        isaac_uniform_u64(&ctx, values, UNIFORM_COUNT, bounds[b]);
+        uint64_t largest = 0;
+        for (size_t i = 0; i < UNIFORM_COUNT; i++)
+        {
+            atto_lt(values[i], bounds[b]);
+            largest = values[i] > largest ? values[i] : largest;
+        }
+        // The upper part of the range is reached, not only the lower bits
+        atto_ge(largest, bounds[b] - bounds[b] / 100 - 1);
+    }
+
+#if ISAAC_BITS > 32
+    // Without rejections (tiny bound), the results are the upper bits of the
+    // product, one integer of the stream each
+    isaac_uint_t words[4];
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, words, 4);
+    isaac_init(&ctx, NULL, 0);
+    isaac_uniform_u64(&ctx, values, 4, 2);
+    for (size_t i = 0; i < 4; i++)
+    {
+        atto_eq(values[i], words[i] >> 63U);
+    }
+#endif
+}
+
+static void test_uniform_floats_match_reference(void)
+{
+    static isaac_uint_t words[UNIFORM_WORDS];
+    static double expected64[UNIFORM_COUNT];
+    static double obtained64[UNIFORM_COUNT];
+    static float expected32[UNIFORM_COUNT];
+    static float obtained32[UNIFORM_COUNT];
+    isaac_ctx_t ctx;
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, words, UNIFORM_WORDS);
+    for (size_t i = 0; i < UNIFORM_COUNT; i++)
+    {
+#if ISAAC_BITS > 32
+        const uint64_t bits64 = words[i];
+        const uint32_t bits32 = (uint32_t) (words[i / 2] >> (32U * (i % 2)));
+#else
+        const uint64_t bits64 = ((uint64_t) words[2 * i] << 32U)
+                                | words[2 * i + 1];
+        const uint32_t bits32 = words[i];
+#endif
+        expected64[i] = (double) (bits64 >> 11U) / 9007199254740992.0;
+        expected32[i] = (float) (bits32 >> 8U) / 16777216.0F;
+    }
+
+    for (size_t k = 0; k < TEST_KERNELS; k++)
+    {
+        if (!isaac_kernel_select(test_kernel_names[k]))
+        {
+            continue;  // Not supported by this CPU
+        }
+        isaac_init(&ctx, NULL, 0);
+        isaac_uniform_f64(&ctx, obtained64, UNIFORM_COUNT);
+        atto_memeq(obtained64, expected64, sizeof(expected64));
+        isaac_init(&ctx, NULL, 0);
+        isaac_uniform_f32(&ctx, obtained32, UNIFORM_COUNT);
+        atto_memeq(obtained32, expected32, sizeof(expected32));
+    }
+    atto_eq(isaac_kernel_select(NULL), true);
+
+    for (size_t i = 0; i < UNIFORM_COUNT; i++)
+    {
+        atto_ge(obtained64[i], 0.0);
+        atto_lt(obtained64[i], 1.0);
+        atto_ge(obtained32[i], 0.0F);
+        atto_lt(obtained32[i], 1.0F);
+    }
+    isaac_uniform_f64(NULL, obtained64, 1);
+    isaac_uniform_f64(&ctx, NULL, 1);
+    isaac_uniform_f32(NULL, obtained32, 1);
+    isaac_uniform_f32(&ctx, NULL, 1);
+}
+
+void test_isaac_uniform(void)
+{
+    test_uniform_null();
+    test_uniform_u32_matches_reference();
+    test_uniform_u32_unbiased();
+    test_uniform_u64();
+    test_uniform_floats_match_reference();
+}
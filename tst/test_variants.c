@@ -0,0 +1,58 @@
+/**
+ * @file
+ *
+ * Test suite of LibISAAC, testing the usage of both ISAAC variants in the same
+ * program.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "test.h"
+
+static void test_variants_types(void)
+{
+    atto_eq(sizeof(isaac32_uint_t), 4);
+    atto_eq(sizeof(isaac64_uint_t), 8);
+#if !ISAAC_CTX_ALIGNED
+    atto_eq(sizeof(isaac32_ctx_t) * 2, sizeof(isaac64_ctx_t));
+#endif
+    atto_eq(sizeof(isaac_uint_t) * 8, ISAAC_BITS);
+    atto_eq(ISAAC_API_BITS, ISAAC_BITS);
+}
+
+static void test_variants_side_by_side(void)
+{
+    isaac32_ctx_t ctx32;
+    isaac64_ctx_t ctx64;
+    isaac32_uint_t value32;
+    isaac64_uint_t value64;
+    isaac_ctx_t ctx;
+    isaac_uint_t value;
+
+    isaac32_init(&ctx32, NULL, 0);
+    isaac64_init(&ctx64, NULL, 0);
+    isaac32_stream(&ctx32, &value32, 1);
+    isaac64_stream(&ctx64, &value64, 1);
+    // First values of the zero-seed streams of the original implementations
+    atto_eq(value32, 0xE76DD339UL);
+    atto_eq(value64, 0x48CBFF086DDF285AULL);
+
+    // The names without bitness are the default variant
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, &value, 1);
+#if ISAAC_BITS > 32
+    atto_eq(value, value64);
+#else
+    atto_eq(value, value32);
+#endif
+    isaac32_cleanup(&ctx32);
+    isaac64_cleanup(&ctx64);
+}
+
+void test_isaac_variants(void)
+{
+    test_variants_types();
+    test_variants_side_by_side();
+}
@@ -0,0 +1,119 @@
+/**
+ * @file
+ *
+ * Test suite of LibISAAC, testing isaac_stream_view(),
+ * isaac_stream_consume() and isaac_discard().
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "test.h"
+
+#define VIEW_STREAM_LEN 700
+
+static void test_view_null(void)
+{
+    isaac_ctx_t ctx;
+    size_t available = 42;
+    isaac_init(&ctx, NULL, 0);
+
+    atto_eq(isaac_stream_view(NULL, &available), NULL);
+    atto_eq(available, 0);
+    atto_eq(isaac_stream_view(&ctx, NULL), NULL);
+    isaac_stream_consume(NULL, 1);
+}
+
+static void test_view_matches_stream(void)
+{
+    isaac_ctx_t ctx;
+    isaac_ctx_t reference;
+    const uint8_t seed[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    isaac_uint_t expected[VIEW_STREAM_LEN];
+    isaac_uint_t obtained[VIEW_STREAM_LEN];
+    const isaac_uint_t* view;
+    size_t available;
+    size_t taken = 0;
+    size_t chunk = 1;
+    isaac_init(&ctx, seed, sizeof(seed));
+    isaac_init(&reference, seed, sizeof(seed));
+    isaac_stream(&reference, expected, VIEW_STREAM_LEN);
+
+    while (taken < VIEW_STREAM_LEN)
+    {
+        view = isaac_stream_view(&ctx, &available);
+        atto_neq(view, NULL);
+        atto_ge(available, 1);
+        atto_le(available, ISAAC_ELEMENTS);
+        if (chunk > available)
+        {
+            chunk = available;
+        }
+        if (chunk > VIEW_STREAM_LEN - taken)
+        {
+            chunk = VIEW_STREAM_LEN - taken;
+        }
+        memcpy(&obtained[taken], view, chunk * sizeof(isaac_uint_t));
+        isaac_stream_consume(&ctx, chunk);
+        taken += chunk;
+        chunk = chunk * 3 + 1;
+    }
+
+    atto_memeq(obtained, expected, sizeof(expected));
+    atto_eq(ctx.stream_index, reference.stream_index);
+}
+
+static void test_consume_more_than_available(void)
+{
+    isaac_ctx_t ctx;
+    isaac_uint_t expected[ISAAC_ELEMENTS + 1];
+    const isaac_uint_t* view;
+    size_t available;
+    isaac_init(&ctx, NULL, 0);
+    isaac_stream(&ctx, expected, ISAAC_ELEMENTS + 1);
+    isaac_init(&ctx, NULL, 0);
+
+    isaac_stream_consume(&ctx, 10);
+    isaac_stream_consume(&ctx, 10 * ISAAC_ELEMENTS);
+
+    view = isaac_stream_view(&ctx, &available);
+    atto_eq(available, ISAAC_ELEMENTS);
+    atto_eq(view[0], expected[ISAAC_ELEMENTS]);
+}
+
+static void test_discard_matches_stream(void)
+{
+    isaac_ctx_t ctx;
+    isaac_ctx_t reference;
+    static isaac_uint_t skipped[3 * ISAAC_ELEMENTS + 100];
+    isaac_uint_t expected[ISAAC_ELEMENTS];
+    isaac_uint_t obtained[ISAAC_ELEMENTS];
+    uint8_t byte;
+    const size_t amounts[] = {0, 1, 155, 156, 157, ISAAC_ELEMENTS,
+                              2 * ISAAC_ELEMENTS + 156,
+                              3 * ISAAC_ELEMENTS + 100};
+    for (size_t i = 0; i < sizeof(amounts) / sizeof(amounts[0]); i++)
+    {
+        isaac_init(&reference, NULL, 0);
+        isaac_stream(&reference, expected, 100);
+        isaac_stream_bytes(&reference, &byte, 1, ISAAC_LITTLE_ENDIAN);
+        ctx = reference;
+
+        isaac_stream(&reference, skipped, amounts[i]);
+        isaac_stream(&reference, expected, ISAAC_ELEMENTS);
+        isaac_discard(&ctx, amounts[i]);
+        isaac_stream(&ctx, obtained, ISAAC_ELEMENTS);
+        atto_memeq(obtained, expected, sizeof(expected));
+        atto_memeq(&ctx, &reference, sizeof(ctx));  // Same state
+    }
+    isaac_discard(NULL, 1);
+}
+
+void test_isaac_view(void)
+{
+    test_view_null();
+    test_view_matches_stream();
+    test_consume_more_than_available();
+    test_discard_matches_stream();
+}
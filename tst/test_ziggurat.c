@@ -0,0 +1,135 @@
+/**
+ * @file
+ *
+ * Test suite of LibISAAC, testing the normal and exponential distributions.
+ *
+ * @copyright Copyright © 2020, Matjaž Guštin <dev@matjaz.it>
+ * <https://matjaz.it>. All rights reserved.
+ * @license BSD 3-clause license.
+ */
+
+#include "test.h"
+
+#define ZIGGURAT_COUNT 200000
+
+static double samples[ZIGGURAT_COUNT];
+static double expected[ZIGGURAT_COUNT];
+
+static void test_ziggurat_null(void)
+{
+    isaac_ctx_t ctx;
+    double out[2] = {0};
+    isaac_init(&ctx, NULL, 0);
+
+    isaac_normal_f64(NULL, out, 2);
+    isaac_normal_f64(&ctx, NULL, 2);
+    isaac_exponential_f64(NULL, out, 2);
+    isaac_exponential_f64(&ctx, NULL, 2);
+
+    atto_eq(out[0], 0.0);
+    atto_eq(out[1], 0.0);
+    atto_eq(ctx.stream_index, 0);
+}
+
+static void test_ziggurat_normal_moments(void)
+{
+    isaac_ctx_t ctx;
+    double sum = 0;
+    double squares = 0;
+    size_t within_one = 0;
+    size_t tails = 0;
+    isaac_init(&ctx, NULL, 0);
+
+    isaac_normal_f64(&ctx, samples, ZIGGURAT_COUNT);
+    for (size_t i = 0; i < ZIGGURAT_COUNT; i++)
+    {
+        sum += samples[i];
+        squares += samples[i] * samples[i];
+        within_one += samples[i] > -1.0 && samples[i] < 1.0;
+        tails += samples[i] < -3.6541528853610088
+                 || samples[i] > 3.6541528853610088;
+    }
+    const double mean = sum / ZIGGURAT_COUNT;
+    atto_ddelta(mean, 0.0, 0.01);
+    atto_ddelta(squares / ZIGGURAT_COUNT - mean * mean, 1.0, 0.02);
+    atto_ddelta((double) within_one / ZIGGURAT_COUNT, 0.6827, 0.005);
+    // About 2.6e-4 of the samples, through the tail sampling
+    atto_gt(tails, 20);
+    atto_lt(tails, 100);
+}
+
+static void test_ziggurat_exponential_moments(void)
+{
+    isaac_ctx_t ctx;
+    double sum = 0;
+    double squares = 0;
+    size_t below_one = 0;
+    size_t tails = 0;
+    isaac_init(&ctx, NULL, 0);
+
+    isaac_exponential_f64(&ctx, samples, ZIGGURAT_COUNT);
+    for (size_t i = 0; i < ZIGGURAT_COUNT; i++)
+    {
+        atto_ge(samples[i], 0.0);
+        sum += samples[i];
+        squares += samples[i] * samples[i];
+        below_one += samples[i] < 1.0;
+        tails += samples[i] > 7.69711747013104972;
+    }
+    const double mean = sum / ZIGGURAT_COUNT;
+    atto_ddelta(mean, 1.0, 0.01);
+    atto_ddelta(squares / ZIGGURAT_COUNT - mean * mean, 1.0, 0.03);
+    atto_ddelta((double) below_one / ZIGGURAT_COUNT, 0.6321, 0.005);
+    // About 4.5e-4 of the samples, through the tail sampling
+    atto_gt(tails, 40);
+    atto_lt(tails, 150);
+}
+
+static void test_ziggurat_kernels_same_output(void)
+{
+    isaac_ctx_t ctx;
+    isaac_uint_t expected_next;
+    isaac_uint_t next;
+    for (int exponential = 0; exponential <= 1; exponential++)
+    {
+        atto_eq(isaac_kernel_select("portable"), true);
+        isaac_init(&ctx, NULL, 0);
+        if (exponential)
+        {
+            isaac_exponential_f64(&ctx, expected, ZIGGURAT_COUNT);
+        }
+        else
+        {
+            isaac_normal_f64(&ctx, expected, ZIGGURAT_COUNT);
+        }
+        isaac_stream(&ctx, &expected_next, 1);
+        for (size_t k = 1; k < TEST_KERNELS; k++)
+        {
+            if (!isaac_kernel_select(test_kernel_names[k]))
+            {
+                continue;  // Not supported by this CPU
+            }
+            isaac_init(&ctx, NULL, 0);
+            if (exponential)
+            {
+                isaac_exponential_f64(&ctx, samples, ZIGGURAT_COUNT);
+            }
+            else
+            {
+                isaac_normal_f64(&ctx, samples, ZIGGURAT_COUNT);
+            }
+            atto_memeq(samples, expected, sizeof(expected));
+            isaac_stream(&ctx, &next, 1);
+            atto_eq(next, expected_next);
+        }
+    }
+    atto_eq(isaac_kernel_select(NULL), true);
+}
+
+void test_isaac_ziggurat(void)
+{
+    test_ziggurat_null();
+    test_ziggurat_normal_moments();
+    test_ziggurat_exponential_moments();
+    test_ziggurat_kernels_same_output();
+}